@@ -8,7 +8,7 @@
 #
 # QMake Settings, 1
 #
-QT         += core gui widgets
+QT         += core gui widgets concurrent
 TARGET      = AwesomeMapEditor
 TEMPLATE    = app
 CONFIG     += c++11
@@ -114,7 +114,22 @@ SOURCES += \
     src/Widgets/Rendering/AMEEntityView.cpp \
     src/Widgets/Rendering/AMEMapView.cpp \
     src/Widgets/Rendering/Cursor.cpp \
-    src/Mapping/CurrentMapManager.cpp
+    src/Mapping/CurrentMapManager.cpp \
+    src/System/RomData.cpp \
+    src/System/RomCursor.cpp \
+    src/Mapping/LayoutManager.cpp \
+    src/Mapping/MapBlockGrid.cpp \
+    src/Algorithm/Lz77.cpp \
+    src/System/Tracer.cpp \
+    src/System/IndexCache.cpp \
+    src/Graphics/MapRenderer.cpp \
+    src/System/RomGenerator.cpp \
+    src/Graphics/BlocksetCache.cpp \
+    src/Mapping/MapFill.cpp \
+    src/Mapping/BlockReplace.cpp \
+    src/System/SaveEngine.cpp \
+    src/System/FreespaceIndex.cpp \
+    src/Graphics/GbaGraphics.cpp
 
 
 #
@@ -190,7 +205,22 @@ HEADERS  += \
     include/AME/Widgets/Rendering/AMEMapView.h \
     include/AME/Widgets/Listeners/MovePermissionListener.h \
     include/AME/Widgets/Rendering/Cursor.hpp \
-    include/AME/Mapping/CurrentMapManager.hpp
+    include/AME/Mapping/CurrentMapManager.hpp \
+    include/AME/System/RomData.hpp \
+    include/AME/System/RomCursor.hpp \
+    include/AME/Mapping/LayoutManager.hpp \
+    include/AME/Mapping/MapBlockGrid.hpp \
+    include/AME/Algorithm/Lz77.hpp \
+    include/AME/System/Tracer.hpp \
+    include/AME/System/IndexCache.hpp \
+    include/AME/Graphics/MapRenderer.hpp \
+    include/AME/System/RomGenerator.hpp \
+    include/AME/Graphics/BlocksetCache.hpp \
+    include/AME/Mapping/MapFill.hpp \
+    include/AME/Mapping/BlockReplace.hpp \
+    include/AME/System/SaveEngine.hpp \
+    include/AME/System/FreespaceIndex.hpp \
+    include/AME/Graphics/GbaGraphics.hpp
 
 
 #
@@ -0,0 +1,164 @@
+#
+# AwesomeMapEditor: A map editor for GBA Pokémon games.
+# Copyright (C) 2016 Diegoisawesome, Pokedude
+# License: General Public License 3.0
+#
+# Headless command-line tool; links all modules that do
+# not depend on widgets.
+#
+
+
+#
+# QMake Settings, 1
+#
+QT         += core gui concurrent
+QT         -= widgets
+TARGET      = ame-cli
+TEMPLATE    = app
+CONFIG     += c++11 console
+CONFIG     -= app_bundle
+DEFINES    += AME_CLI
+
+# do only use if getting those useless BUILT_IN warnings
+CONFIG     += warn_off
+
+
+#
+# QMake Settings, 2
+#
+INCLUDEPATH += include
+INCLUDEPATH += $$PWD/../QBoy/include
+DEPENDPATH  += $$PWD/../QBoy/include
+INCLUDEPATH += $$PWD/../QBoy/bin
+DEPENDPATH += $$PWD/../QBoy/bin
+INCLUDEPATH += $$PWD/../yaml-cpp/include
+DEPENDPATH += $$PWD/../yaml-cpp/include
+INCLUDEPATH += $$PWD/../yaml-cpp/bin
+DEPENDPATH += $$PWD/../yaml-cpp/bin
+QMAKE_LFLAGS += -static-libgcc -static-libstdc++
+
+
+#
+# QMake Settings, 3
+#
+win32:CONFIG(release, debug|release): LIBS += -L$$PWD/../QBoy/bin/release/ -lQBoy
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$PWD/../QBoy/bin/debug/ -lQBoy
+else:unix: LIBS += -L$$PWD/../QBoy/bin/ -lQBoy
+unix|win32: LIBS += -L$$PWD/../yaml-cpp/bin/ -lyaml-cpp
+
+
+#
+# Source Files
+#
+SOURCES += \
+    src/Cli/main.cpp \
+    src/System/WriteEntry.cpp \
+    src/System/ErrorStack.cpp \
+    src/Text/Tables.cpp \
+    src/Text/String.cpp \
+    src/Structures/WildPokemonTable.cpp \
+    src/Structures/WildPokemonSubTable.cpp \
+    src/Structures/WildPokemonArea.cpp \
+    src/Entities/MapScriptTable.cpp \
+    src/Entities/ConnectionTable.cpp \
+    src/Entities/EventTable.cpp \
+    src/Graphics/Tileset.cpp \
+    src/Graphics/TilesetManager.cpp \
+    src/Mapping/MapBorder.cpp \
+    src/Mapping/MapHeader.cpp \
+    src/Mapping/MapNameTable.cpp \
+    src/Mapping/Map.cpp \
+    src/Mapping/MapBank.cpp \
+    src/Mapping/MapBankTable.cpp \
+    src/System/Configuration.cpp \
+    src/System/LoadedData.cpp \
+    src/Structures/PokemonTable.cpp \
+    src/Graphics/OverworldTable.cpp \
+    src/Graphics/PropertyTable.cpp \
+    src/System/Settings.cpp \
+    src/Entities/EntityRawData.cpp \
+    src/Mapping/MapLayoutTable.cpp \
+    src/Structures/ItemTable.cpp \
+    src/Mapping/CurrentMapManager.cpp \
+    src/System/RomData.cpp \
+    src/System/RomCursor.cpp \
+    src/Mapping/LayoutManager.cpp \
+    src/Mapping/MapBlockGrid.cpp \
+    src/Algorithm/Lz77.cpp \
+    src/System/Tracer.cpp \
+    src/System/IndexCache.cpp \
+    src/Graphics/MapRenderer.cpp \
+    src/System/RomGenerator.cpp \
+    src/Graphics/BlocksetCache.cpp \
+    src/Mapping/MapFill.cpp \
+    src/Mapping/BlockReplace.cpp \
+    src/System/SaveEngine.cpp \
+    src/System/FreespaceIndex.cpp \
+    src/Graphics/GbaGraphics.cpp
+
+
+#
+# Header Files
+#
+HEADERS  += \
+    include/AME/Structures/WildPokemonTable.hpp \
+    include/AME/System/ErrorStack.hpp \
+    include/AME/System/WriteEntry.hpp \
+    include/AME/System/IUndoable.hpp \
+    include/AME/Text/String.hpp \
+    include/AME/Text/Tables.hpp \
+    include/AME/Structures/WildPokemonSubTable.hpp \
+    include/AME/Structures/StructureErrors.hpp \
+    include/AME/Structures/WildPokemonArea.hpp \
+    include/AME/Structures/WildPokemonEncounter.hpp \
+    include/AME/Entities/Warp.hpp \
+    include/AME/Entities/Sign.hpp \
+    include/AME/Entities/EntityTypes.hpp \
+    include/AME/Entities/Trigger.hpp \
+    include/AME/Entities/Npc.hpp \
+    include/AME/Entities/Connection.hpp \
+    include/AME/Entities/MapScript.hpp \
+    include/AME/Entities/AutoScript.hpp \
+    include/AME/Entities/Tables/EntityErrors.hpp \
+    include/AME/Entities/Tables/MapScriptTable.hpp \
+    include/AME/Entities/Tables/ConnectionTable.hpp \
+    include/AME/Entities/Tables/EventTable.hpp \
+    include/AME/Graphics/Tileset.hpp \
+    include/AME/Graphics/Tile.hpp \
+    include/AME/Graphics/Block.hpp \
+    include/AME/Graphics/GraphicsErrors.hpp \
+    include/AME/Mapping/MapBlock.hpp \
+    include/AME/Mapping/MapHeader.hpp \
+    include/AME/Graphics/TilesetManager.hpp \
+    include/AME/Mapping/MapBorder.hpp \
+    include/AME/Mapping/MappingErrors.hpp \
+    include/AME/Mapping/Map.hpp \
+    include/AME/Mapping/MapBank.hpp \
+    include/AME/Mapping/MapBankTable.hpp \
+    include/AME/Mapping/MapNameTable.hpp \
+    include/AME/System/Configuration.hpp \
+    include/AME/System/LoadedData.hpp \
+    include/AME/Structures/PokemonTable.hpp \
+    include/AME/Graphics/OverworldTable.hpp \
+    include/AME/Graphics/PropertyTable.hpp \
+    include/AME/Graphics/Property.hpp \
+    include/AME/System/Settings.hpp \
+    include/AME/Mapping/MapName.hpp \
+    include/AME/Mapping/MapLayoutTable.hpp \
+    include/AME/Structures/ItemTable.hpp \
+    include/AME/Mapping/CurrentMapManager.hpp \
+    include/AME/System/RomData.hpp \
+    include/AME/System/RomCursor.hpp \
+    include/AME/Mapping/LayoutManager.hpp \
+    include/AME/Mapping/MapBlockGrid.hpp \
+    include/AME/Algorithm/Lz77.hpp \
+    include/AME/System/Tracer.hpp \
+    include/AME/System/IndexCache.hpp \
+    include/AME/Graphics/MapRenderer.hpp \
+    include/AME/System/RomGenerator.hpp \
+    include/AME/Graphics/BlocksetCache.hpp \
+    include/AME/Mapping/MapFill.hpp \
+    include/AME/Mapping/BlockReplace.hpp \
+    include/AME/System/SaveEngine.hpp \
+    include/AME/System/FreespaceIndex.hpp \
+    include/AME/Graphics/GbaGraphics.hpp
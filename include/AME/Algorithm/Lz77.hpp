@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_LZ77_HPP__
+#define __AME_LZ77_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomData.hpp>
+#include <QByteArray>
+#include <QList>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  Lz77Benchmark
+    /// \brief   Holds the results of Lz77::benchmark().
+    ///
+    /// Throughput is measured in uncompressed megabytes per
+    /// second for both directions.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct Lz77Benchmark
+    {
+        Int32 payloads;             ///< Amount of payloads measured
+        UInt32 compressedBytes;     ///< Size of all ROM payloads
+        UInt32 decompressedBytes;   ///< Size of all decoded payloads
+        UInt32 recompressedBytes;   ///< Size of all payloads encoded by us
+        double decodeSpeed;         ///< Decoder throughput, in MB/s
+        double encodeSpeed;         ///< Encoder throughput, in MB/s
+        bool roundTrip;             ///< Did all payloads survive encoding?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    Lz77.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Encodes and decodes GBA BIOS LZ77 data (type 0x10).
+    ///
+    /// The stream starts with the byte 0x10 and the 24-bit
+    /// decompressed size, followed by blocks of one flag byte
+    /// and eight tokens. A set flag bit denotes a back reference
+    /// of 3 to 18 bytes, up to 4096 bytes behind.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Lz77 {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Retrieves the decompressed size of a stream.
+        /// \param    src Compressed stream
+        /// \param    size Maximum amount of bytes to consider
+        /// \returns  -1 if the stream is not LZ77 data.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 decompressedSize(const UInt8 *src, UInt32 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Decompresses the given stream.
+        /// \param    src Compressed stream
+        /// \param    size Maximum amount of bytes to consider
+        /// \param    dest Receives the decompressed data
+        /// \param    read Receives the length of the stream, optional
+        /// \returns  false if the stream is malformed or truncated.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool decompress(const UInt8 *src, UInt32 size, QByteArray &dest, UInt32 *read = NULL);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Decompresses the stream at the given offset.
+        /// \param    rom ROM snapshot to read from
+        /// \param    offset Offset of the compressed stream
+        /// \param    dest Receives the decompressed data
+        /// \returns  false if the stream is malformed or truncated.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool decompress(const RomData &rom, UInt32 offset, QByteArray &dest);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Compresses the given data.
+        ///
+        /// Back references never point to the directly preceding
+        /// byte, so the stream can be decoded straight to VRAM.
+        /// The result is padded to a multiple of four bytes.
+        ///
+        /// \param    src Data to compress, at most 16 MB
+        /// \returns  the compressed stream.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QByteArray compress(const QByteArray &src);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Measures the codec on the given payloads.
+        ///
+        /// Every payload is decompressed and compressed again
+        /// \p rounds times; the re-encoded data is verified to
+        /// decode to the original data.
+        ///
+        /// \param    rom ROM snapshot to read from
+        /// \param    offsets Offsets of the compressed payloads
+        /// \param    rounds Amount of repetitions per payload
+        /// \returns  the benchmark results.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Lz77Benchmark benchmark(const RomData &rom, const QList<UInt32> &offsets, Int32 rounds);
+    };
+}
+
+
+#endif // __AME_LZ77_HPP__
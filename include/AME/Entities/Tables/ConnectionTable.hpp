@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Entities/Connection.hpp>
@@ -108,7 +108,7 @@ namespace ame
         /// \returns true if all scripts were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
 
         ///////////////////////////////////////////////////////////
         /// \brief Determines whether a repoint is required.
@@ -118,7 +118,7 @@ namespace ame
         /// except if there are enough trailing 0xFF bytes.
         ///
         ///////////////////////////////////////////////////////////
-        bool requiresRepoint(const qboy::Rom &rom);
+        bool requiresRepoint(const RomCursor &rom);
 
         ///////////////////////////////////////////////////////////
         /// \brief Writes the connections to the given offset.
@@ -133,7 +133,31 @@ namespace ame
         /// \returns a list of write entries to use for the rom.
         ///
         ///////////////////////////////////////////////////////////
-        QList<WriteEntry> write(UInt32 offset = 0);
+        QList<WriteEntry> write(UInt32 offset = 0) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Applies the entries of write to the table.
+        ///
+        /// Call this function once the entries were written to
+        /// the ROM; the table then describes the written data.
+        ///
+        /// \param offset The offset that was passed to write
+        ///
+        ///////////////////////////////////////////////////////////
+        void commit(UInt32 offset = 0);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the table was modified
+        ///        since it was read or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isModified() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Marks the table as modified or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setModified(bool modified);
 
 
         ///////////////////////////////////////////////////////////
@@ -222,6 +246,7 @@ namespace ame
         Int32 m_Count;                  ///< Connection amount
         UInt32 m_PtrData;               ///< Offset of the data
         QList<Connection *> m_Connections;
+        bool m_IsModified;              ///< Modified since the last save
     };
 }
 
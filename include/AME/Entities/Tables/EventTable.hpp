@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Entities/Npc.hpp>
@@ -109,7 +109,7 @@ namespace ame
         /// \returns true if all events were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
 
 
         ///////////////////////////////////////////////////////////
@@ -122,7 +122,7 @@ namespace ame
         /// \returns a combo of types that need to be repointed.
         ///
         ///////////////////////////////////////////////////////////
-        EntityType requiresRepoint(const qboy::Rom &rom);
+        EntityType requiresRepoint(const RomCursor &rom);
 
         ///////////////////////////////////////////////////////////
         /// \brief Writes the event table to the given offset.
@@ -136,12 +136,37 @@ namespace ame
         /// If one of these entries does not require a repoint,
         /// simply place a nullptr instead. Example:
         /// { 0xABCDEF, 0x0, 0xFEDCAB, 0x0 }
+        /// An empty list writes all types to the same offsets.
         ///
         /// \param offsets List of repointed type offsets
         /// \returns a list of write entries to use for the rom.
         ///
         ///////////////////////////////////////////////////////////
-        QList<WriteEntry> write(const QList<UInt32> &offsets);
+        QList<WriteEntry> write(const QList<UInt32> &offsets) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Applies the entries of write to the table.
+        ///
+        /// Call this function once the entries were written to
+        /// the ROM; the table then describes the written data.
+        ///
+        /// \param offsets The offsets that were passed to write
+        ///
+        ///////////////////////////////////////////////////////////
+        void commit(const QList<UInt32> &offsets);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the table was modified
+        ///        since it was read or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isModified() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Marks the table as modified or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setModified(bool modified);
 
 
         ///////////////////////////////////////////////////////////
@@ -254,6 +279,7 @@ namespace ame
         QList<Warp *> m_Warps;          ///< Holds all warps
         QList<Sign *> m_Signs;          ///< Holds all signs
         QList<Trigger *> m_Triggers;    ///< Holds all triggers
+        bool m_IsModified;              ///< Modified since the last save
     };
 }
 
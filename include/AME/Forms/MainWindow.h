@@ -39,7 +39,6 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
 #include <AME/Mapping/Map.hpp>
 #include <AME/Mapping/CurrentMapManager.hpp>
 #include <AME/Widgets/QFilterChildrenProxyModel.h>
@@ -136,6 +135,15 @@ namespace ame
         bool loadMap(Map *currentMap);
         bool loadMap(Map *currentMap, const QString &name);
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Parses the tables of the map, if necessary.
+        ///
+        /// Maps are read lazily on ROM load; this parses the
+        /// given map and all of its connected maps.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool loadMapTables(Map *map);
+
         ///////////////////////////////////////////////////////////
         /// \brief Changes the loaded map in the treeview.
         ///
@@ -196,6 +204,7 @@ namespace ame
         void setScriptEditorButtonsEnabled(bool enabled);
 
         void on_action_Open_ROM_triggered();
+        void on_action_Save_ROM_triggered();
         void on_sldWildGrassChance_valueChanged(int value);
         void on_sldWildWaterChance_valueChanged(int value);
         void on_sldWildFishingChance_valueChanged(int value);
@@ -232,7 +241,7 @@ namespace ame
         //
         ///////////////////////////////////////////////////////////////////////////////////////////////////
         Ui::MainWindow *ui;                         ///< Gives access to the GUI objects
-        qboy::Rom m_Rom;                            ///< Global ROM across the application
+        QString m_RomPath;                          ///< Path of the ROM across the application
         QModelIndex *m_lastOpenedMap;               ///< Pointer to the model index for the last opened map
         Map *m_CurrentMap;                            ///< Pointer to currently opened map
         QLabel m_statusLabel;                       ///< Status bar label primary segment
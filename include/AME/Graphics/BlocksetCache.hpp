@@ -0,0 +1,172 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_BLOCKSETCACHE_HPP__
+#define __AME_BLOCKSETCACHE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Graphics/Tileset.hpp>
+#include <QByteArray>
+#include <QVector>
+#include <QMutex>
+#include <QHash>
+#include <QList>
+#include <QRgb>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \brief Holds the composed blocks of a tileset pair.
+    ///
+    /// Both layers are 128 pixels wide and indexed into the
+    /// palette; the secondary blocks follow the primary ones,
+    /// so that every block of a map can be looked up directly.
+    /// The buffers are implicitly shared and stay valid even
+    /// if the cache evicts the pair.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct Blockset
+    {
+        QByteArray background;  ///< Bottom layer of all blocks
+        QByteArray foreground;  ///< Top layer of all blocks
+        QVector<QRgb> palette;  ///< Combined palettes of both tilesets
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    BlocksetCache.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Caches composed blocksets by tileset pair.
+    ///
+    /// Many maps share the same primary and secondary tileset.
+    /// Their blocksets are composed once and kept until the
+    /// memory cap is reached; then the least recently used
+    /// pairs are evicted first.
+    ///
+    ///////////////////////////////////////////////////////////
+    class BlocksetCache {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the blockset of the tileset pair.
+        ///
+        /// Composes the blockset on a miss. Is thread-safe; the
+        /// composition itself happens outside of the lock.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Blockset get(const Tileset *primary, const Tileset *secondary);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Evicts every pair that uses the given tileset.
+        ///
+        /// Must be called whenever a tileset is modified.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void invalidate(UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Evicts all blocksets and resets the statistics.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void clear();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the memory cap, in bytes.
+        ///
+        /// The most recently used blockset is always kept, even
+        /// if it exceeds the cap on its own.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void setCapacity(UInt32 bytes);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the memory cap, in bytes.
+        ///
+        ///////////////////////////////////////////////////////////
+        static UInt32 capacity();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the memory occupied by all blocksets.
+        ///
+        ///////////////////////////////////////////////////////////
+        static UInt32 residentBytes();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of lookups that succeeded.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 hits();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of lookups that failed.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 misses();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Evicts the least recent blocksets above the cap.
+        ///
+        /// The caller must hold the lock.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void evict();
+
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static QHash<quint64, Blockset> m_Blocksets;   ///< Holds all blocksets
+        static QList<quint64> m_Recent;                ///< Keys, least recent first
+        static UInt32 m_Capacity;                      ///< Memory cap
+        static UInt32 m_Resident;                      ///< Occupied memory
+        static Int32 m_Hits;                           ///< Successful lookups
+        static Int32 m_Misses;                         ///< Failed lookups
+        static QMutex m_Mutex;                         ///< Guards the members
+    };
+}
+
+
+#endif // __AME_BLOCKSETCACHE_HPP__
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#ifndef __AME_GBAGRAPHICS_HPP__
+#define __AME_GBAGRAPHICS_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomData.hpp>
+#include <QByteArray>
+#include <QVector>
+#include <QRgb>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    GbaGraphics.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Decodes uncompressed GBA palettes and images.
+    ///
+    /// Palettes consist of 15-bit BGR colors; images consist
+    /// of 8x8 tiles with two pixels per byte, the left one in
+    /// the lower nybble. Reads directly from ame::RomData and
+    /// can therefore be used from any thread.
+    ///
+    ///////////////////////////////////////////////////////////
+    class GbaGraphics {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Reads the palette at the given offset.
+        ///
+        /// All colors are opaque; callers decide whether the first
+        /// color of the palette is transparent.
+        ///
+        /// \param    rom ROM snapshot to read from
+        /// \param    offset Offset of the palette
+        /// \param    dest Receives the converted colors
+        /// \param    count Amount of colors to read
+        /// \returns  false if the palette exceeds the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool readPalette(const RomData &rom, UInt32 offset, QVector<QRgb> &dest, Int32 count = 16);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Converts 4bpp tiles to one byte per pixel.
+        ///
+        /// The tiles are laid out from left to right and top to
+        /// bottom; the last row is padded with zero pixels.
+        ///
+        /// \param    tiles Tile data, 32 bytes per tile
+        /// \param    tileCount Amount of tiles to convert
+        /// \param    width Width of the image, in pixels
+        /// \param    dest Receives the palette indices
+        ///
+        ///////////////////////////////////////////////////////////
+        static void decodeTiles(const UInt8 *tiles, Int32 tileCount, Int32 width, QByteArray &dest);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Reads the 4bpp image at the given offset.
+        /// \param    rom ROM snapshot to read from
+        /// \param    offset Offset of the tile data
+        /// \param    width Width of the image, in pixels
+        /// \param    height Height of the image, in pixels
+        /// \param    dest Receives the palette indices
+        /// \returns  false if the image exceeds the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool readImage(const RomData &rom, UInt32 offset, Int32 width, Int32 height, QByteArray &dest);
+    };
+}
+
+
+#endif // __AME_GBAGRAPHICS_HPP__
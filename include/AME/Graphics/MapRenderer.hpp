@@ -0,0 +1,173 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_MAPRENDERER_HPP__
+#define __AME_MAPRENDERER_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Graphics/Tileset.hpp>
+#include <AME/Mapping/MapHeader.hpp>
+#include <QImage>
+#include <QVector>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  TileBenchmark
+    /// \brief   Holds the results of MapRenderer::benchmark().
+    ///
+    /// Throughput is measured in million tiles per second.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TileBenchmark
+    {
+        Int32 tiles;                ///< Amount of tiles per round
+        double referenceSpeed;      ///< Per-pixel drawing, in Mtiles/s
+        double kernelSpeed;         ///< Row-wise drawing, in Mtiles/s
+        bool identical;             ///< Do both produce the same pixels?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    MapRenderer.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Composes blocksets and maps from tilesets.
+    ///
+    /// Blocksets are 128 pixels wide, eight blocks per row,
+    /// and hold one palette index per pixel; background and
+    /// foreground layers are kept in separate buffers. All
+    /// functions are reentrant and use no widget classes, so
+    /// maps can be rendered on any thread and without display.
+    ///
+    ///////////////////////////////////////////////////////////
+    class MapRenderer {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the block capacity of primary tilesets.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 primaryBlockCount();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the block capacity of secondary tilesets.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 secondaryBlockCount();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Combines the palettes of both tilesets.
+        ///
+        /// Always yields 256 colors; the first color of every
+        /// palette is transparent.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QVector<QRgb> palette(const Tileset *primary, const Tileset *secondary);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Draws a single tile of the given image.
+        ///
+        /// Applies the flip flags and offsets the pixels by the
+        /// palette of the tile. Tiles beyond the image are drawn
+        /// with index zero. Whole rows are processed at once,
+        /// with SSE2 if available and 64-bit words otherwise.
+        ///
+        /// \param image Tileset image, 128 pixels wide
+        /// \param tile Tile to draw, relative to the image
+        /// \param dest Top-left destination pixel
+        /// \param stride Width of the destination, in pixels
+        ///
+        ///////////////////////////////////////////////////////////
+        static void drawTile(const QByteArray &image, const Tile &tile, UInt8 *dest, Int32 stride);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Draws all blocks of a tileset to a blockset.
+        ///
+        /// Tiles below primaryBlockCount() are taken from the
+        /// primary, all others from the secondary tileset.
+        ///
+        /// \param tileset Tileset whose blocks should be drawn
+        /// \param primary Primary tileset of the layout
+        /// \param secondary Secondary tileset of the layout
+        /// \param capacity Maximum amount of blocks to draw
+        /// \param background Destination of the bottom layer
+        /// \param foreground Destination of the top layer
+        ///
+        ///////////////////////////////////////////////////////////
+        static void drawBlockset(const Tileset *tileset, const Tileset *primary, const Tileset *secondary,
+                                 Int32 capacity, UInt8 *background, UInt8 *foreground);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Copies a 16x16 block out of a blockset.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void drawBlock(const UInt8 *blockset, Int32 block, UInt8 *dest, Int32 stride);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Renders the whole layout to an image.
+        ///
+        /// Composes the foreground over the background just like
+        /// the map view does; the background color is opaque.
+        ///
+        /// \returns a null image if a tileset is missing.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QImage render(const MapHeader &header);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Measures drawTile() on the given tilesets.
+        ///
+        /// All tiles of both tilesets are drawn \p rounds times,
+        /// once per pixel and once with drawTile(); the resulting
+        /// blocksets are verified to be identical.
+        ///
+        /// \param    primary Primary tileset of the layout
+        /// \param    secondary Secondary tileset of the layout
+        /// \param    rounds Amount of repetitions
+        /// \returns  the benchmark results.
+        ///
+        ///////////////////////////////////////////////////////////
+        static TileBenchmark benchmark(const Tileset *primary, const Tileset *secondary, Int32 rounds);
+    };
+}
+
+
+#endif // __AME_MAPRENDERER_HPP__
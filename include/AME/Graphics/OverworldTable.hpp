@@ -39,8 +39,9 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Graphics/Image.hpp>
-#include <QBoy/Graphics/Palette.hpp>
+#include <AME/System/RomCursor.hpp>
+#include <QImage>
+#include <QVector>
 
 
 namespace ame
@@ -103,14 +104,16 @@ namespace ame
         /// \returns true if all things were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom);
+        bool read(const RomCursor &rom);
 
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves all OW pictures.
         ///
+        /// Holds one palette index per pixel.
+        ///
         ///////////////////////////////////////////////////////////
-        const QList<qboy::Image *> &images() const;
+        const QList<QByteArray> &images() const;
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves all OW pictures in ARGB.
@@ -122,7 +125,7 @@ namespace ame
         /// \brief Retrieves all OW palettes.
         ///
         ///////////////////////////////////////////////////////////
-        const QList<qboy::Palette *> &palettes() const;
+        const QList<QVector<QRgb>> &palettes() const;
 
 
     private:
@@ -131,8 +134,8 @@ namespace ame
         // Class members
         //
         ///////////////////////////////////////////////////////////
-        QList<qboy::Palette *> m_Palettes;
-        QList<qboy::Image *> m_Images;
+        QList<QVector<QRgb>> m_Palettes;
+        QList<QByteArray> m_Images;
         QList<QImage> m_Argb;
     };
 }
@@ -39,8 +39,9 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/Graphics/Property.hpp>
+#include <QVector>
 
 
 namespace ame
@@ -101,14 +102,44 @@ namespace ame
         /// \returns true if all properties were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset, Int32 blocks);
+        bool read(const RomCursor &rom, UInt32 offset, Int32 blocks);
 
 
         ///////////////////////////////////////////////////////////
-        /// \brief Retrieves all Pokémon pictures.
+        /// \brief Retrieves the amount of properties.
         ///
         ///////////////////////////////////////////////////////////
-        const QList<Property *> &properties() const;
+        Int32 count() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the properties of the given block.
+        ///
+        ///////////////////////////////////////////////////////////
+        Property property(Int32 block) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the behaviour of the given block.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 behaviour(Int32 block) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the background of the given block.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 background(Int32 block) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the behaviours of all blocks.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QVector<UInt16> &behaviours() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the backgrounds of all blocks.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QVector<UInt16> &backgrounds() const;
 
 
     private:
@@ -118,7 +149,8 @@ namespace ame
         //
         ///////////////////////////////////////////////////////////
         UInt32 m_Offset;
-        QList<Property *> m_Properties; ///< Holds all decoded images
+        QVector<UInt16> m_Behaviours;   ///< Behaviour of every block
+        QVector<UInt16> m_Backgrounds;  ///< Background of every block
     };
 }
 
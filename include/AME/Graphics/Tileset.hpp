@@ -39,12 +39,15 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Graphics/Image.hpp>
-#include <QBoy/Graphics/Palette.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Graphics/Block.hpp>
 #include <AME/Graphics/PropertyTable.hpp>
+#include <QMutex>
+#include <QSize>
+#include <QVector>
+#include <QRgb>
 
 
 namespace ame
@@ -58,6 +61,9 @@ namespace ame
     ///
     /// Undo/redo system to be implemented later.
     ///
+    /// The image is not decoded by read(); it is decompressed
+    /// the first time it is requested through pixels().
+    ///
     ///////////////////////////////////////////////////////////
     class Tileset /*: public IUndoable*/ {
     public:
@@ -112,7 +118,7 @@ namespace ame
         /// \returns true if all scripts were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
 
 
         ///////////////////////////////////////////////////////////
@@ -122,26 +128,101 @@ namespace ame
         UInt32 offset() const;
 
         ///////////////////////////////////////////////////////////
-        /// \brief Retrieves the image of this tileset.
+        /// \brief Retrieves the offset of the tileset image.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 imageOffset() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the image is LZ77-compressed.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isCompressed() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the pixels of this tileset.
+        ///
+        /// Holds one palette index per pixel, row by row, with
+        /// a width of 128 pixels. Decodes the image on the first
+        /// call; other threads requesting the image meanwhile
+        /// wait for the decoding.
         ///
         ///////////////////////////////////////////////////////////
-        qboy::Image *image() const;
+        const QByteArray &pixels() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the size of the image, in pixels.
+        ///
+        ///////////////////////////////////////////////////////////
+        QSize imageSize() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the image was decoded yet.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isDecoded() const;
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves the palettes of this tileset.
         ///
         ///////////////////////////////////////////////////////////
-        const QList<qboy::Palette *> &palettes() const;
+        const QList<QVector<QRgb>> &palettes() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of blocks in this tileset.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 blockCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the packed tiles of all blocks.
+        ///
+        /// Every block consists of eight consecutive tile words,
+        /// the four bottom layer tiles followed by the four top
+        /// layer tiles, encoded exactly like in the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        const UInt16 *blockData() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes a single tile of the given block.
+        ///
+        ///////////////////////////////////////////////////////////
+        Tile tile(Int32 block, Int32 index) const;
 
         ///////////////////////////////////////////////////////////
-        /// \brief Retrieves the blocks of this tileset.
+        /// \brief Decodes all tiles of the given block.
         ///
         ///////////////////////////////////////////////////////////
-        const QList<Block *> &blocks() const;
+        Block block(Int32 index) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the block properties of this tileset.
+        ///
+        ///////////////////////////////////////////////////////////
+        const PropertyTable &properties() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Estimates the memory occupied by this tileset.
+        ///
+        /// Counts the pixel data, the palettes, the blocks and
+        /// the block properties, in bytes.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 residentBytes() const;
 
 
     private:
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes the image of this tileset.
+        ///
+        /// Must be called with the decode mutex being held.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool decodeImage() const;
+
+
         ///////////////////////////////////////////////////////////
         // Class members
         //
@@ -154,9 +235,13 @@ namespace ame
         UInt32 m_PtrBlocks;             ///< Offset of the blocks
         UInt32 m_PtrAnimations;         ///< Offset of the tile anims
         UInt32 m_PtrBehaviour;          ///< Offset of the behaviour bytes
-        qboy::Image *m_Image;           ///< Actual image holding 4bpp data
-        QList<qboy::Palette *> m_Pals;  ///< Holds all palettes (6/7)
-        QList<Block *> m_Blocks;        ///< Holds all blocks, amount depends on type
+        Int32 m_UncompSize;             ///< Size of an uncompressed image
+        const RomData *m_Rom;           ///< ROM to decode the image from
+        mutable QByteArray m_Pixels;    ///< Decoded image, one byte per pixel
+        mutable bool m_IsDecoded;       ///< Was the image decoded yet?
+        mutable QMutex m_DecodeMutex;   ///< Guards the image decoding
+        QList<QVector<QRgb>> m_Pals;    ///< Holds all palettes (6/7)
+        QVector<UInt16> m_Tiles;        ///< Holds 8 tile words per block
         PropertyTable *m_Properties;    ///< Holds all block properties
     };
 }
@@ -31,6 +31,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 
 
+
 #ifndef __AME_TILESETMANAGER_HPP__
 #define __AME_TILESETMANAGER_HPP__
 
@@ -40,10 +41,26 @@
 //
 ///////////////////////////////////////////////////////////
 #include <AME/Graphics/Tileset.hpp>
+#include <QMutex>
+#include <QHash>
+#include <QFuture>
 
 
 namespace ame
 {
+    ///////////////////////////////////////////////////////////
+    /// \brief Describes the usage of a single managed tileset.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TilesetUsage
+    {
+        Tileset *tileset;       ///< RAM location of the tileset
+        Int32 references;       ///< Amount of layouts using it
+        Int32 hits;             ///< Amount of lookups that found it
+        UInt32 residentBytes;   ///< Memory occupied by the tileset
+    };
+
+
     ///////////////////////////////////////////////////////////
     /// \file    TilesetManager.hpp
     /// \author  Pokedude
@@ -51,6 +68,10 @@ namespace ame
     /// \date    6/10/2016
     /// \brief   Holds all tilesets in the game.
     ///
+    /// Tilesets are indexed by their offset and reference-
+    /// counted; every layout that uses a tileset holds one
+    /// reference and releases it once it is destroyed.
+    ///
     ///////////////////////////////////////////////////////////
     class TilesetManager {
     public:
@@ -58,32 +79,103 @@ namespace ame
         ///////////////////////////////////////////////////////////
         /// \brief Adds the specified tileset to the manager.
         ///
+        /// If a tileset with the same offset was added in the
+        /// meantime (e.g. by another loading thread), the given
+        /// tileset is not added and the existing one is returned.
+        /// The caller is responsible for freeing its own copy then.
+        /// Either way, the caller holds one reference afterwards.
+        ///
         ///////////////////////////////////////////////////////////
-        static void add(Tileset *tileset);
+        static Tileset *add(Tileset *tileset);
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves the specified tileset, by offset.
         ///
         /// Returns NULL if the tileset does not exist; returns the
         /// RAM pointer to tileset of the specified offset otherwise.
+        /// On success, the caller holds one reference afterwards.
         ///
         ///////////////////////////////////////////////////////////
         static Tileset *get(UInt32 offset);
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Acquires another reference to the tileset.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void acquire(Tileset *tileset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Releases one reference to the tileset.
+        ///
+        /// The tileset is freed as soon as no references remain.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void release(Tileset *tileset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes the given tileset images in background.
+        ///
+        /// Images are decoded on demand otherwise; this warms the
+        /// cache for tilesets that are likely to be drawn soon,
+        /// e.g. the ones of a map and its connections. Tilesets
+        /// that are decoded already or not managed are skipped.
+        /// Must be called from the main thread.
+        ///
+        /// \param tilesets Tilesets to decode, may contain NULL
+        ///
+        ///////////////////////////////////////////////////////////
+        static void warmUp(const QList<Tileset *> &tilesets);
+
         ///////////////////////////////////////////////////////////
         /// \brief Frees all tilesets within the manager.
         ///
+        /// Also resets the lookup statistics and waits for the
+        /// background decoding to stop. Must be called from the
+        /// main thread.
+        ///
         ///////////////////////////////////////////////////////////
         static void clear();
 
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of lookups that succeeded.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 hits();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of lookups that failed.
+        ///
+        ///////////////////////////////////////////////////////////
+        static Int32 misses();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the usage of the specified tileset.
+        ///
+        /// All members are zero if the tileset is not managed.
+        ///
+        ///////////////////////////////////////////////////////////
+        static TilesetUsage usage(UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the usage of all managed tilesets.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QList<TilesetUsage> usages();
+
+
     private:
 
         ///////////////////////////////////////////////////////////
         // Static class members
         //
         ///////////////////////////////////////////////////////////
-        static QList<Tileset *> m_Tilesets; ///< Holds all tilesets
+        static QHash<UInt32, TilesetUsage> m_Tilesets; ///< Holds all tilesets
+        static Int32 m_Hits;                           ///< Successful lookups
+        static Int32 m_Misses;                         ///< Failed lookups
+        static QList<Tileset *> m_Pending;             ///< Tilesets to decode
+        static QFuture<void> m_WarmUp;                 ///< Background decoding
+        static QMutex m_Mutex;                         ///< Guards the members
     };
 }
 
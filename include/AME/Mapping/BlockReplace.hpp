@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_BLOCKREPLACE_HPP__
+#define __AME_BLOCKREPLACE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/IUndoable.hpp>
+#include <AME/System/WriteEntry.hpp>
+#include <AME/Mapping/MapHeader.hpp>
+#include <QList>
+#include <QVector>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  ReplaceRule
+    /// \brief   Describes which cells to replace and how.
+    ///
+    /// Negative values match any block or permission, or keep
+    /// the block or permission of the cell when replacing.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct ReplaceRule
+    {
+        Int16 block;            ///< Block index to match
+        Int16 permission;       ///< Movement permission to match
+        UInt32 tileset;         ///< Tileset the layout must use, or zero
+        MapBlock replacement;   ///< Block and permission to write
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \struct  ReplaceCount
+    /// \brief   Holds the preview of one layout.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct ReplaceCount
+    {
+        MapHeader *header;      ///< Layout that would be changed
+        Int32 cells;            ///< Amount of cells that would change
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    BlockReplace.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Replaces blocks across many layouts at once.
+    ///
+    /// The layouts are searched and modified in parallel, one
+    /// task per layout. All changes of one apply() form a single
+    /// edit set that can be undone, redone and written back to
+    /// the ROM. Map views showing an affected layout have to be
+    /// reloaded afterwards.
+    ///
+    ///////////////////////////////////////////////////////////
+    class BlockReplace : public IUndoable {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new instance of ame::BlockReplace with
+        /// the given rule.
+        ///
+        ///////////////////////////////////////////////////////////
+        BlockReplace(const ReplaceRule &rule);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Counts the cells the rule would change.
+        ///
+        /// Layouts without changes and layouts that do not use
+        /// the tileset of the rule are left out.
+        ///
+        /// \param headers Layouts to search, e.g. the layout table
+        /// \returns the amount of changed cells per layout.
+        ///
+        ///////////////////////////////////////////////////////////
+        QList<ReplaceCount> preview(const QList<MapHeader *> &headers) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Applies the rule to all given layouts.
+        ///
+        /// Replaces the edit set of a previous call.
+        ///
+        /// \returns the amount of changed cells.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 apply(const QList<MapHeader *> &headers);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Restores all cells changed by apply().
+        ///
+        ///////////////////////////////////////////////////////////
+        void undo();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Changes all cells again after undo().
+        ///
+        ///////////////////////////////////////////////////////////
+        void redo();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the block data of all changed layouts.
+        ///
+        /// The entries reflect the current state of the layouts,
+        /// so that they can be staged in the ROM after undo() or
+        /// redo() as well.
+        ///
+        ///////////////////////////////////////////////////////////
+        QList<WriteEntry> write() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of changed layouts.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 layoutCount() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Holds the changed cells of one layout.
+        ///
+        ///////////////////////////////////////////////////////////
+        struct Change
+        {
+            MapHeader *header;      ///< Layout that was changed
+            QVector<Int32> cells;   ///< Indices of the changed cells
+            QVector<UInt16> before; ///< Cells before the change
+            QVector<UInt16> after;  ///< Cells after the change
+        };
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the layout uses the tileset.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool accepts(const MapHeader *header) const;
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        ReplaceRule m_Rule;         ///< Rule to apply
+        UInt16 m_MatchMask;         ///< Cell bits compared by the rule
+        UInt16 m_MatchValue;        ///< Expected value of these bits
+        UInt16 m_KeepMask;          ///< Cell bits kept when replacing
+        UInt16 m_WriteValue;        ///< Bits written when replacing
+        QList<Change> m_Changes;    ///< Changes of the last apply()
+    };
+}
+
+
+#endif // __AME_BLOCKREPLACE_HPP__
@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_LAYOUTMANAGER_HPP__
+#define __AME_LAYOUTMANAGER_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/MapHeader.hpp>
+#include <QMutex>
+#include <QHash>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    LayoutManager.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Holds all map layouts in the game.
+    ///
+    /// Maps and the layout table refer to the same layouts;
+    /// every layout is parsed once and shared by everyone
+    /// that references its offset.
+    ///
+    ///////////////////////////////////////////////////////////
+    class LayoutManager {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Adds the specified layout to the manager.
+        ///
+        /// If a layout with the same offset was added in the
+        /// meantime (e.g. by another loading thread), the given
+        /// layout is not added and the existing one is returned.
+        /// The caller is responsible for freeing its own copy then.
+        ///
+        ///////////////////////////////////////////////////////////
+        static MapHeader *add(MapHeader *layout);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the specified layout, by offset.
+        ///
+        /// Returns NULL if the layout does not exist; returns the
+        /// RAM pointer to layout of the specified offset otherwise.
+        ///
+        ///////////////////////////////////////////////////////////
+        static MapHeader *get(UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the specified layout, by offset.
+        ///
+        /// Reads and adds the layout if it does not exist yet.
+        ///
+        /// \param rom Currently opened ROM file
+        /// \param offset Offset of the layout
+        /// \returns NULL if the layout could not be read.
+        ///
+        ///////////////////////////////////////////////////////////
+        static MapHeader *load(const RomCursor &rom, UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves all layouts with unsaved blocks.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QList<MapHeader *> modified();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Frees all layouts within the manager.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void clear();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static QHash<UInt32, MapHeader *> m_Layouts; ///< Holds all layouts
+        static QMutex m_Mutex;                       ///< Guards the layouts
+    };
+}
+
+
+#endif // __AME_LAYOUTMANAGER_HPP__
@@ -105,21 +105,49 @@ namespace ame
         ///////////////////////////////////////////////////////////
         /// \brief Attempts to read the map.
         ///
-        /// Reads the header, events, connections and properties.
+        /// Only reads the table pointers and the properties, which
+        /// suffices to list the map. The header, events, scripts
+        /// and connections are parsed on demand by load().
         ///
         /// \param rom Currently opened ROM file
         /// \param offset Offset of the map
         /// \returns true if the map was read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Attempts to parse all tables of the map.
+        ///
+        /// Reads the header, events, scripts and connections, if
+        /// they have not been read yet. Must be called before any
+        /// of these are accessed.
+        ///
+        /// \param rom Currently opened ROM file
+        /// \returns true if the tables were read correctly.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool load(const RomCursor &rom);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the tables have been parsed.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isLoaded() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offset of the map.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 offset() const;
 
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves a reference to the map's header.
         ///
         /// The map header is required to be modified outside this
-        /// class to reduce complexity concerning undo/redo.
+        /// class to reduce complexity concerning undo/redo. The
+        /// header is shared with every other map using the layout.
         ///
         /// \returns a reference to the map header.
         ///
@@ -239,12 +267,13 @@ namespace ame
         UInt8 m_MiscByte2;              ///< Miscellaneous bitmask byte 2
         UInt8 m_MiscByte3;              ///< Miscellaneous bitmask byte 3
         UInt8 m_BattleType;             ///< Battle intro type
-        MapHeader m_Header;             ///< Holds the map header properties
+        MapHeader *m_Header;            ///< Shared layout, owned by LayoutManager
         EventTable m_Events;            ///< Holds all the entities
         MapScriptTable m_Scripts;       ///< Holds all level scripts
         ConnectionTable m_Connections;  ///< Holds all connections
         Int32 m_WildTable;              ///< Holds the wild Pokémon table index
         QModelIndex *m_TreeViewIndex;   ///< Holds a pointer to the model index
+        bool m_IsLoaded;                ///< Determines whether tables were parsed
     };
 }
 Q_DECLARE_METATYPE(ame::Map *)
@@ -110,7 +110,22 @@ namespace ame
        /// \returns true if the map was read correctly.
        ///
        ///////////////////////////////////////////////////////////
-       bool read(const qboy::Rom &rom, UInt32 offset, UInt32 next);
+       bool read(const RomCursor &rom, UInt32 offset, UInt32 next);
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Reads the bank from a previously built index.
+       ///
+       /// Skips the map count algorithm and reads the maps at
+       /// the given offsets right away.
+       ///
+       /// \param rom Currently opened ROM file
+       /// \param offset Offset of the current bank
+       /// \param maps Offsets of all maps in the bank
+       /// \param count Amount of maps in the bank
+       /// \returns true if the maps were read correctly.
+       ///
+       ///////////////////////////////////////////////////////////
+       bool restore(const RomCursor &rom, UInt32 offset, const UInt32 *maps, UInt32 count);
 
 
        ///////////////////////////////////////////////////////////
@@ -41,6 +41,7 @@
 ///////////////////////////////////////////////////////////
 #include <AME/Mapping/MapBank.hpp>
 #include <AME/Mapping/MappingErrors.hpp>
+#include <AME/System/IndexCache.hpp>
 
 
 namespace ame
@@ -107,7 +108,20 @@ namespace ame
        /// \returns true if the map was read correctly.
        ///
        ///////////////////////////////////////////////////////////
-       bool read(const qboy::Rom &rom, UInt32 offset);
+       bool read(const RomCursor &rom, UInt32 offset);
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Reads all banks from a previously built index.
+       ///
+       /// Skips the bank and map count algorithms entirely.
+       ///
+       /// \param rom Currently opened ROM file
+       /// \param offset Offset of the bank table
+       /// \param index Loaded index with the offsets of all banks
+       /// \returns true if the maps were read correctly.
+       ///
+       ///////////////////////////////////////////////////////////
+       bool restore(const RomCursor &rom, UInt32 offset, const IndexCache &index);
 
 
        ///////////////////////////////////////////////////////////
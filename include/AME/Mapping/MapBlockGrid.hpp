@@ -0,0 +1,215 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_MAPBLOCKGRID_HPP__
+#define __AME_MAPBLOCKGRID_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomCursor.hpp>
+#include <AME/Mapping/MapBlock.hpp>
+#include <QVector>
+#include <QPoint>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    MapBlockGrid.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Stores all blocks of a map in one array.
+    ///
+    /// Every cell is stored exactly like in the ROM: the lower
+    /// ten bits hold the block index, the upper six bits hold
+    /// the movement permission. Cells are laid out row by row,
+    /// so iterating the grid linearly walks the map from the
+    /// top-left to the bottom-right corner.
+    ///
+    ///////////////////////////////////////////////////////////
+    class MapBlockGrid {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new, empty instance of ame::MapBlockGrid.
+        ///
+        ///////////////////////////////////////////////////////////
+        MapBlockGrid();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads all cells of the grid at once.
+        ///
+        /// \param rom Currently opened ROM file
+        /// \param offset Offset of the block data
+        /// \param width Width of the map in blocks
+        /// \param height Height of the map in blocks
+        /// \returns false if the dimensions are invalid or the
+        ///          data exceeds the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool read(const RomCursor &rom, UInt32 offset, Int32 width, Int32 height);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Resizes the grid; all cells are set to zero.
+        ///
+        ///////////////////////////////////////////////////////////
+        void resize(Int32 width, Int32 height);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the width of the grid, in blocks.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 width() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the height of the grid, in blocks.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 height() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of cells in the grid.
+        ///
+        ///////////////////////////////////////////////////////////
+        Int32 size() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the position lies in the grid.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool contains(Int32 x, Int32 y) const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the cell at the given index.
+        ///
+        ///////////////////////////////////////////////////////////
+        MapBlock at(Int32 index) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the cell at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        MapBlock at(Int32 x, Int32 y) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the block index at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 block(Int32 x, Int32 y) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the permission at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt8 permission(Int32 x, Int32 y) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Modifies the cell at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        void set(Int32 x, Int32 y, const MapBlock &block);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Modifies the block index at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setBlock(Int32 x, Int32 y, UInt16 block);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Modifies the permission at the given position.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setPermission(Int32 x, Int32 y, UInt8 permission);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves a pointer to the packed cells.
+        ///
+        /// Meant for code that needs to walk the whole grid, such
+        /// as rendering and filling.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 *data();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves a constant pointer to the packed cells.
+        ///
+        ///////////////////////////////////////////////////////////
+        const UInt16 *data() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the cells as they are stored in ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        QByteArray rawData() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QVector<UInt16> m_Cells;    ///< Holds the packed cells
+        Int32 m_Width;              ///< Width of the grid in blocks
+        Int32 m_Height;             ///< Height of the grid in blocks
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Packed cell layout
+    //
+    ///////////////////////////////////////////////////////////
+    #define MBG_BLOCK_MASK  0x3FF
+    #define MBG_PERM_SHIFT  0xA
+
+
+    ///////////////////////////////////////////////////////////
+    // Largest width or height accepted from the ROM
+    //
+    ///////////////////////////////////////////////////////////
+    #define MBG_MAX_SIZE    0x800
+}
+
+
+#endif // __AME_MAPBLOCKGRID_HPP__
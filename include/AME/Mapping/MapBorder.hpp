@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Mapping/MapBlock.hpp>
@@ -112,7 +112,7 @@ namespace ame
         /// \returns true if the map-header was read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset, const QSize &size);
+        bool read(const RomCursor &rom, UInt32 offset, const QSize &size);
 
 
         ///////////////////////////////////////////////////////////
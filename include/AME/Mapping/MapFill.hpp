@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_MAPFILL_HPP__
+#define __AME_MAPFILL_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/MapBlockGrid.hpp>
+#include <QVector>
+#include <QRect>
+#include <QSize>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  FillBenchmark
+    /// \brief   Holds the results of MapFill::benchmark().
+    ///
+    /// Throughput is measured in million cells per second.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct FillBenchmark
+    {
+        Int32 cells;                ///< Amount of cells per round
+        Int32 matches;              ///< Amount of replaced cells per round
+        double referenceSpeed;      ///< Cell by cell replacing, in Mcells/s
+        double replaceSpeed;        ///< MapFill::replace(), in Mcells/s
+        bool identical;             ///< Do both produce the same grid?
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    MapFill.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Fills areas of a block grid with a pattern.
+    ///
+    /// Works on the packed cells of the grid directly. Cells
+    /// match when their block index or, in permission mode,
+    /// their movement permission equals the one of the start
+    /// cell. The pattern is tiled over the map starting at the
+    /// start cell; pattern entries below zero keep the block
+    /// or permission of the cell they are written to.
+    ///
+    ///////////////////////////////////////////////////////////
+    class MapFill {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Fills the area connected to the start cell.
+        ///
+        /// Walks the area row by row, one span of matching cells
+        /// at a time, instead of cell by cell.
+        ///
+        /// \param grid Block grid to fill
+        /// \param start Cell the fill starts from
+        /// \param pattern Blocks to write, row by row
+        /// \param patternSize Size of the pattern, in blocks
+        /// \param permissions Match permissions instead of blocks?
+        /// \param changed Receives the indices of changed cells
+        /// \returns the bounding rectangle of all changed cells.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QRect flood(MapBlockGrid &grid, const QPoint &start, const QVector<MapBlock> &pattern,
+                           const QSize &patternSize, bool permissions, QVector<Int32> *changed = NULL);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Replaces every matching cell of the grid.
+        ///
+        /// Compares eight cells at once with SSE2, if available,
+        /// and writes the pattern to all matches of a row in the
+        /// same pass.
+        ///
+        /// \param grid Block grid to modify
+        /// \param start Cell whose key is replaced
+        /// \param pattern Blocks to write, row by row
+        /// \param patternSize Size of the pattern, in blocks
+        /// \param permissions Match permissions instead of blocks?
+        /// \param changed Receives the indices of changed cells
+        /// \returns the bounding rectangle of all changed cells.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QRect replace(MapBlockGrid &grid, const QPoint &start, const QVector<MapBlock> &pattern,
+                             const QSize &patternSize, bool permissions, QVector<Int32> *changed = NULL);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief    Measures replace() on a copy of the grid.
+        ///
+        /// Replaces the block of the top-left cell with a 2x2
+        /// pattern \p rounds times, once cell by cell through the
+        /// grid accessors and once with replace(); the resulting
+        /// grids are verified to be identical.
+        ///
+        /// \param    grid Block grid to measure on
+        /// \param    rounds Amount of repetitions
+        /// \returns  the benchmark results.
+        ///
+        ///////////////////////////////////////////////////////////
+        static FillBenchmark benchmark(const MapBlockGrid &grid, Int32 rounds);
+    };
+}
+
+
+#endif // __AME_MAPFILL_HPP__
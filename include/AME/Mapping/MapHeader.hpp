@@ -42,7 +42,7 @@
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Graphics/Tileset.hpp>
-#include <AME/Mapping/MapBlock.hpp>
+#include <AME/Mapping/MapBlockGrid.hpp>
 #include <AME/Mapping/MapBorder.hpp>
 
 
@@ -111,7 +111,31 @@ namespace ame
         /// \returns true if the map-header was read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes the map-blocks to the same offset.
+        ///
+        /// The size of a layout never changes, so the blocks
+        /// do not require a repoint.
+        ///
+        /// \returns a list of write entries to use for the rom.
+        ///
+        ///////////////////////////////////////////////////////////
+        QList<WriteEntry> write() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the blocks were modified
+        ///        since they were read or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isModified() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Marks the blocks as modified or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setModified(bool modified);
 
 
         ///////////////////////////////////////////////////////////
@@ -124,19 +148,28 @@ namespace ame
         /// \brief Retrieves all the map-blocks.
         ///
         ///////////////////////////////////////////////////////////
-        const QList<MapBlock *> &blocks() const;
+        const MapBlockGrid &blocks() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves all the map-blocks for modification.
+        ///
+        ///////////////////////////////////////////////////////////
+        MapBlockGrid &blocks();
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves a map block based on coordinates.
         ///
+        /// Both members of the returned block are -1 if the
+        /// coordinates lie outside of the map.
+        ///
         ///////////////////////////////////////////////////////////
-        MapBlock *getBlock(int x, int y);
+        MapBlock getBlock(int x, int y) const;
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves a map block based on QPoint coords.
         ///
         ///////////////////////////////////////////////////////////
-        MapBlock *getBlock(QPoint pos);
+        MapBlock getBlock(QPoint pos) const;
 
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves the offset of this map.
@@ -156,6 +189,12 @@ namespace ame
         ///////////////////////////////////////////////////////////
         UInt32 ptrSecondary() const;
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offset of the block data.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 ptrBlocks() const;
+
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves the primary tileset for this map.
         ///
@@ -194,10 +233,11 @@ namespace ame
         UInt32 m_PtrBorder;           ///< Offset of the map border
         UInt32 m_PtrPrimary;          ///< Offset of the primary tileset
         UInt32 m_PtrSecondary;        ///< Offset of the secondary tileset
-        QList<MapBlock *> m_Blocks;   ///< Holds the actual map blocks
+        MapBlockGrid m_Blocks;        ///< Holds the actual map blocks
         MapBorder m_Border;           ///< Holds the map border blocks
         Tileset *m_Primary;           ///< RAM location of primary set
         Tileset *m_Secondary;         ///< RAM location of secondary set
+        bool m_IsModified;            ///< Modified since the last save
     };
 }
 
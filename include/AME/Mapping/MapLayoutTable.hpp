@@ -109,7 +109,22 @@ namespace ame
        /// \returns true if the layouts were read correctly.
        ///
        ///////////////////////////////////////////////////////////
-       bool read(const qboy::Rom &rom, UInt32 offset);
+       bool read(const RomCursor &rom, UInt32 offset);
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Restores the table from a previously built index.
+       ///
+       /// Skips the layout count algorithm entirely and defers
+       /// reading the layouts until they are first requested.
+       ///
+       /// \param rom Currently opened ROM file
+       /// \param offset Offset of the layout table
+       /// \param layouts Offsets of all layouts; zero if empty
+       /// \param count Amount of layouts
+       /// \returns true if the layouts were read correctly.
+       ///
+       ///////////////////////////////////////////////////////////
+       bool restore(const RomCursor &rom, UInt32 offset, const UInt32 *layouts, UInt32 count);
 
 
        ///////////////////////////////////////////////////////////
@@ -121,9 +136,40 @@ namespace ame
        ///////////////////////////////////////////////////////////
        /// \brief Retrieves a constant reference to all layouts.
        ///
+       /// Loads all layouts that were not requested so far.
+       ///
        ///////////////////////////////////////////////////////////
        const QList<MapHeader *> &mapHeaders() const;
 
+       ///////////////////////////////////////////////////////////
+       /// \brief Retrieves the layout at the given index.
+       ///
+       /// Loads the layout if it was not requested so far.
+       ///
+       ///////////////////////////////////////////////////////////
+       MapHeader *mapHeader(Int32 index) const;
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Retrieves the offset of the layout at the given
+       ///        index, without loading it.
+       ///
+       ///////////////////////////////////////////////////////////
+       UInt32 layoutOffset(Int32 index) const;
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Retrieves the primary tileset offset of the
+       ///        layout at the given index, without loading it.
+       ///
+       ///////////////////////////////////////////////////////////
+       UInt32 primaryOffset(Int32 index) const;
+
+       ///////////////////////////////////////////////////////////
+       /// \brief Retrieves the secondary tileset offset of the
+       ///        layout at the given index, without loading it.
+       ///
+       ///////////////////////////////////////////////////////////
+       UInt32 secondaryOffset(Int32 index) const;
+
        ///////////////////////////////////////////////////////////
        /// \brief Retrieves the amount of layouts in the layout table.
        ///
@@ -134,13 +180,23 @@ namespace ame
 
    private:
 
+       ///////////////////////////////////////////////////////////
+       /// \brief Loads the layout at the given index.
+       ///
+       ///////////////////////////////////////////////////////////
+       MapHeader *load(Int32 index) const;
+
+
        ///////////////////////////////////////////////////////////
        // Class members
        //
        ///////////////////////////////////////////////////////////
        UInt32 m_Offset;         ///< Offset of the map-bank
        Int32 m_Count;           ///< Amount of map layouts
-       QList<MapHeader *> m_MapHeaders;     ///< Holds the actual maps
+       const RomData *m_Data;   ///< ROM to load the layouts from
+       QList<UInt32> m_Layouts;                     ///< Offsets of all layouts
+       mutable QList<MapHeader *> m_MapHeaders;     ///< Holds the actual maps
+       mutable QList<MapHeader *> m_EmptyHeaders;   ///< Placeholders for null entries
    };
 }
 
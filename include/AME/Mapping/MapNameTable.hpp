@@ -40,6 +40,7 @@
 //
 ///////////////////////////////////////////////////////////
 #include <AME/Mapping/MapName.hpp>
+#include <QStringList>
 
 
 namespace ame
@@ -102,10 +103,11 @@ namespace ame
        ///
        /// \param rom Currently opened ROM file
        /// \param offset Offset of the name table
+       /// \param names Previously decoded names, or NULL
        /// \returns true if the names were read correctly.
        ///
        ///////////////////////////////////////////////////////////
-       bool read(const qboy::Rom &rom, UInt32 offset);
+       bool read(const RomCursor &rom, UInt32 offset, const QStringList *names = NULL);
 
 
        ///////////////////////////////////////////////////////////
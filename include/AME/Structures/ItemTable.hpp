@@ -39,6 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
+#include <AME/System/RomCursor.hpp>
 
 
 namespace ame
@@ -96,10 +97,11 @@ namespace ame
         /// \brief Attempts to read the item names.
         ///
         /// \param rom Currently opened ROM file
+        /// \param names Previously decoded names, or NULL
         /// \returns true if all names were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom);
+        bool read(const RomCursor &rom, const QStringList *names = NULL);
 
 
         ///////////////////////////////////////////////////////////
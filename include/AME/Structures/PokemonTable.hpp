@@ -39,8 +39,9 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Graphics/Image.hpp>
-#include <QBoy/Graphics/Palette.hpp>
+#include <AME/System/RomCursor.hpp>
+#include <QStringList>
+#include <QImage>
 
 
 namespace ame
@@ -100,10 +101,11 @@ namespace ame
         /// For AME, we need the pokémon names, icons and palettes.
         ///
         /// \param rom Currently opened ROM file
+        /// \param names Previously decoded names, or NULL
         /// \returns true if all things were read correctly.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom);
+        bool read(const RomCursor &rom, const QStringList *names = NULL);
 
 
         ///////////////////////////////////////////////////////////
@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Structures/WildPokemonEncounter.hpp>
@@ -109,7 +109,7 @@ namespace ame
         /// \returns true on success.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset, UInt32 amount);
+        bool read(const RomCursor &rom, UInt32 offset, UInt32 amount);
 
         ///////////////////////////////////////////////////////////
         /// \brief Writ<es the encounters to the same offset.
@@ -121,7 +121,7 @@ namespace ame
         /// \returns a list of write entries to use for the rom.
         ///
         ///////////////////////////////////////////////////////////
-        QList<WriteEntry> write(UInt32 offset);
+        QList<WriteEntry> write(UInt32 offset) const;
 
 
         ///////////////////////////////////////////////////////////
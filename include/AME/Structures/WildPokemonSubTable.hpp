@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
 #include <AME/Structures/WildPokemonArea.hpp>
@@ -112,18 +112,21 @@ namespace ame
         /// \returns true on success.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
 
         ///////////////////////////////////////////////////////////
-        /// \brief Writes the area arrays to the same offset.
+        /// \brief Writes the entry and its area arrays.
         ///
         /// As area arrays have a fixed size, they do not require
-        /// a repoint.
+        /// a repoint. The entry itself is written to the given
+        /// offset if the head table is being repointed; the
+        /// sub-table is only moved through setOffset.
         ///
+        /// \param offset New offset of the entry (optional)
         /// \returns a list of write entries to use for the rom.
         ///
         ///////////////////////////////////////////////////////////
-        QList<WriteEntry> write();
+        QList<WriteEntry> write(UInt32 offset = 0) const;
 
 
         ///////////////////////////////////////////////////////////
@@ -145,6 +148,12 @@ namespace ame
         ///////////////////////////////////////////////////////////
         UInt32 offset() const;
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Moves the sub-table along with its head table.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setOffset(UInt32 offset);
+
         ///////////////////////////////////////////////////////////
         /// \brief Retrieves the associated map bank.
         ///
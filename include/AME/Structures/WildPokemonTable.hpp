@@ -39,9 +39,10 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <AME/System/IUndoable.hpp>
 #include <AME/System/WriteEntry.hpp>
+#include <AME/System/FreespaceIndex.hpp>
 #include <AME/Structures/WildPokemonSubTable.hpp>
 
 
@@ -114,7 +115,7 @@ namespace ame
         /// \returns true on success.
         ///
         ///////////////////////////////////////////////////////////
-        bool read(const qboy::Rom &rom, UInt32 offset);
+        bool read(const RomCursor &rom, UInt32 offset);
 
 
         ///////////////////////////////////////////////////////////
@@ -122,25 +123,71 @@ namespace ame
         ///
         /// Compares the current wild pokemon table count to the
         /// old count. If it is bigger, the table requires a repoint
-        /// except if there are enough trailing 0xFF bytes.
+        /// except if the space after the table is indexed as free.
+        ///
+        /// \param freespace Free space of the currently opened ROM
         ///
         ///////////////////////////////////////////////////////////
-        bool requiresRepoint(const qboy::Rom &rom);
+        bool requiresRepoint(const FreespaceIndex &freespace) const;
 
         ///////////////////////////////////////////////////////////
         /// \brief Writes the sub-tables to the given offset.
         ///
-        /// First make sure the object requires a repoint by
-        /// calling WildPokemontable::requiresRepoint and then
-        /// call this function to write the data to the given
-        /// new offset. Call the overloaded non-argument function
+        /// First determine whether the object requires a repoint
+        /// by calling WildPokemonTable::requiresRepoint. If so,
+        /// reserve dataSize() bytes with FreespaceIndex::allocate
+        /// and pass the offset to this function. Omit the offset
         /// to write the data to the same offset as before.
         ///
+        /// The table itself is not changed; call commit once the
+        /// entries were written to the ROM.
+        ///
         /// \param offset New offset of the data (optional)
         /// \returns a list of write entries to use for the rom.
         ///
         ///////////////////////////////////////////////////////////
-        QList<WriteEntry> write(UInt32 offset = 0);
+        QList<WriteEntry> write(UInt32 offset = 0) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Applies the entries of write to the table.
+        ///
+        /// Moves the table to the given offset, if any. Claims
+        /// the space the table grew into and gives back the space
+        /// it no longer occupies.
+        ///
+        /// \param freespace Free space of the currently opened ROM
+        /// \param offset The offset that was passed to write
+        ///
+        ///////////////////////////////////////////////////////////
+        void commit(FreespaceIndex &freespace, UInt32 offset = 0);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offset of the head table.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 offset() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the size of the head table, in bytes,
+        ///        as it would be written.
+        ///
+        /// Includes the entry holding the ending sequence.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 dataSize() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the table was modified
+        ///        since it was read or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isModified() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Marks the table as modified or saved.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setModified(bool modified);
 
 
         ///////////////////////////////////////////////////////////
@@ -148,7 +195,8 @@ namespace ame
         ///
         /// This object is only for read access. Add or remove
         /// entries through the respective functions. The Pokémon
-        /// encounters within the table may be modified directly.
+        /// encounters within the table may be modified directly;
+        /// call WildPokemonTable::setModified afterwards.
         ///
         /// \returns a reference to the sub-tables.
         ///
@@ -170,7 +218,7 @@ namespace ame
         /// \brief Removes a sub-table from the head table.
         ///
         /// This operation does not repoint the table, but cleares
-        /// four bytes of space as one pointer is deleted.
+        /// twenty bytes of space as one entry is deleted.
         ///
         /// \param index Index of the sub-table to remove
         ///
@@ -226,6 +274,7 @@ namespace ame
         UInt32 m_Offset;           ///< Offset of the head table
         Int32 m_Count;             ///< Initial count of sub-tables
         QList<WildPokemonSubTable *> m_Tables;
+        bool m_IsModified;         ///< Modified since the last save
     };
 }
 
@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 #include <QStringList>
 
 
@@ -83,7 +83,22 @@ namespace ame
         /// \returns false if parsing failed.
         ///
         ///////////////////////////////////////////////////////////
-        static bool parse(const qboy::Rom &rom);
+        static bool parse(const RomCursor &rom);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the path of the configuration file.
+        ///
+        /// The file is named after the game code of the ROM and
+        /// located in the config folder next to the executable.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QString filePath(const RomData &rom);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the configuration path for a game code.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QString filePath(const QString &code);
 
 
         ///////////////////////////////////////////////////////////
@@ -99,6 +114,7 @@ namespace ame
         static UInt32 PokemonUsage;
         static UInt32 PokemonPals;
         static UInt32 WildPokemon;
+        static UInt32 WildPokemonRef;
         static UInt32 ItemData;
         static UInt32 ItemCount;
         static UInt32 Overworlds;
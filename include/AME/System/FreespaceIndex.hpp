@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_FREESPACEINDEX_HPP__
+#define __AME_FREESPACEINDEX_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomData.hpp>
+#include <QMultiMap>
+#include <QMap>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    FreespaceIndex.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Keeps track of the free space within the ROM.
+    ///
+    /// Runs of 0xFF bytes from the configured free space start
+    /// on are collected once per load. Afterwards, finding room
+    /// for repointed data is a lookup in the index instead of
+    /// a search through the ROM.
+    ///
+    /// The index is not derived from the ROM again on save; it
+    /// stays valid as long as every write into free space goes
+    /// through allocate() or claim() and every moved block of
+    /// data is given back with free().
+    ///
+    ///////////////////////////////////////////////////////////
+    class FreespaceIndex {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new, empty instance of ame::FreespaceIndex.
+        ///
+        ///////////////////////////////////////////////////////////
+        FreespaceIndex();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Collects all runs of free bytes.
+        ///
+        /// Very short runs are ignored, as they are most likely
+        /// part of the data around them. The first bytes of every
+        /// run are skipped for the same reason.
+        ///
+        /// \param rom Snapshot of the loaded ROM
+        /// \param start Offset where the free space begins
+        ///
+        ///////////////////////////////////////////////////////////
+        void build(const RomData &rom, UInt32 start);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Removes all ranges.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reserves room for the given amount of bytes.
+        ///
+        /// Picks the smallest range that can hold the bytes at
+        /// the given alignment, which keeps the large ranges
+        /// intact for large data.
+        ///
+        /// \param size Amount of bytes to reserve
+        /// \param alignment Power of two, word-aligned by default
+        /// \returns the offset of the room or zero if none of the
+        ///          ranges is large enough.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 allocate(UInt32 size, UInt32 alignment = 4);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reserves the given range, e.g. to let a table
+        ///        grow in place.
+        ///
+        /// \returns false if any byte of the range is not free.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool claim(UInt32 offset, UInt32 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Gives back the range of data that was moved.
+        ///
+        /// The range is merged with adjacent ranges. The caller
+        /// is responsible for clearing the bytes with 0xFF.
+        ///
+        ///////////////////////////////////////////////////////////
+        void free(UInt32 offset, UInt32 size);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the given range is free.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isFree(UInt32 offset, UInt32 size) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves all free ranges, size by offset.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QMap<UInt32, UInt32> &ranges() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of free bytes.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 totalSize() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the size of the largest range.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 largestSize() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Adds a range that overlaps no other range.
+        ///
+        ///////////////////////////////////////////////////////////
+        void insert(UInt32 offset, UInt32 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Removes the range at the given offset.
+        ///
+        ///////////////////////////////////////////////////////////
+        void remove(UInt32 offset);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reserves a part of the range at the given offset.
+        ///
+        ///////////////////////////////////////////////////////////
+        void carve(UInt32 range, UInt32 offset, UInt32 size);
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QMap<UInt32, UInt32> m_Ranges;      ///< Size of every range, by offset
+        QMultiMap<UInt32, UInt32> m_Sizes;  ///< Offset of every range, by size
+        UInt32 m_Total;                     ///< Amount of free bytes
+    };
+}
+
+
+#endif // __AME_FREESPACEINDEX_HPP__
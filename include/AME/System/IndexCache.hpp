@@ -0,0 +1,284 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_INDEXCACHE_HPP__
+#define __AME_INDEXCACHE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <QBoy/Config.hpp>
+#include <QStringList>
+#include <QByteArray>
+#include <QFile>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  IndexBank
+    /// \brief   Holds the offset of a bank and locates its maps.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct IndexBank
+    {
+        UInt32 offset;          ///< Offset of the bank
+        UInt32 first;           ///< Index of the first map offset
+        UInt32 count;           ///< Amount of maps in the bank
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \struct  IndexWildLink
+    /// \brief   Links a map to its wild Pokémon table.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct IndexWildLink
+    {
+        UInt32 bank;            ///< Index of the bank
+        UInt32 map;             ///< Index of the map in the bank
+        UInt32 table;           ///< Index of the wild Pokémon table
+    };
+
+    struct IndexHead;
+    struct IndexString;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    IndexCache.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Persists the results of the ROM discovery.
+    ///
+    /// Counting banks, maps and layouts and decoding all names
+    /// is the slowest part of loading a ROM. Their results only
+    /// change if the ROM or its configuration file change, so
+    /// they are stored in a binary file keyed by a hash of both.
+    /// On the next load, the file is memory-mapped and its
+    /// records are read in place; only the names are converted
+    /// to strings, once, for the tables that keep them.
+    ///
+    ///////////////////////////////////////////////////////////
+    class IndexCache {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new, empty instance of ame::IndexCache.
+        ///
+        ///////////////////////////////////////////////////////////
+        IndexCache();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Unmaps the cache file, if any.
+        ///
+        ///////////////////////////////////////////////////////////
+        ~IndexCache();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Computes a fast 64-bit hash of the given bytes.
+        ///
+        /// Processes eight bytes at once; not cryptographically
+        /// secure, but sensitive to every single changed bit.
+        ///
+        /// \param data Bytes to hash
+        /// \param size Amount of bytes
+        /// \param seed Result of a previous call, to chain buffers
+        ///
+        ///////////////////////////////////////////////////////////
+        static quint64 hash(const UInt8 *data, UInt32 size, quint64 seed = 0);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the path of the cache file for a key.
+        ///
+        /// Indices are stored in the user's cache location.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QString filePath(quint64 key);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Attempts to load the cache file for the key.
+        ///
+        /// The file is memory-mapped and stays mapped until the
+        /// object is destroyed. Fails silently if the file does
+        /// not exist, is damaged or was written for another key
+        /// or format version.
+        ///
+        /// \param key Hash of the ROM and its configuration
+        /// \returns true if the index was loaded.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool load(quint64 key);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes the index to the cache file for the key.
+        ///
+        /// Only a captured index can be written.
+        ///
+        /// \param key Hash of the ROM and its configuration
+        /// \returns false if the file could not be written.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool save(quint64 key) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Captures the index of the loaded global tables.
+        ///
+        /// Must be called after all tables were read and linked.
+        ///
+        ///////////////////////////////////////////////////////////
+        void capture();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of banks.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 bankCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offsets of all banks.
+        ///
+        /// The maps of a bank are located in maps().
+        ///
+        ///////////////////////////////////////////////////////////
+        const IndexBank *banks() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offsets of all map headers.
+        ///
+        ///////////////////////////////////////////////////////////
+        const UInt32 *maps() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of layouts.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 layoutCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the offsets of all layouts.
+        ///
+        /// Empty entries in the layout table are stored as zero.
+        ///
+        ///////////////////////////////////////////////////////////
+        const UInt32 *layouts() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the amount of wild Pokémon links.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 wildLinkCount() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the links of maps to wild Pokémon.
+        ///
+        ///////////////////////////////////////////////////////////
+        const IndexWildLink *wildLinks() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes all map names.
+        ///
+        ///////////////////////////////////////////////////////////
+        QStringList mapNames() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes all Pokémon names.
+        ///
+        ///////////////////////////////////////////////////////////
+        QStringList pokemonNames() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes all item names.
+        ///
+        ///////////////////////////////////////////////////////////
+        QStringList itemNames() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Removes the oldest indices of the given folder.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void evict(const QString &folder);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Locates all records within the given image.
+        ///
+        /// Verifies that every record lies within the image, so
+        /// that the accessors never read past its end.
+        ///
+        /// \param data Image of a cache file
+        /// \param size Size of the image, in bytes
+        /// \returns false if the image is damaged.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool attach(const uchar *data, quint64 size);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Decodes the given name records.
+        ///
+        ///////////////////////////////////////////////////////////
+        QStringList names(const IndexString *strings, UInt32 count) const;
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QFile m_File;                       ///< Mapped cache file
+        uchar *m_Mapped;                    ///< Mapping of the cache file
+        QByteArray m_Image;                 ///< Captured index, in file format
+        const IndexHead *m_Head;            ///< Counts of all records
+        const IndexBank *m_Banks;           ///< Offsets of banks
+        const UInt32 *m_Maps;               ///< Offsets of map headers
+        const UInt32 *m_Layouts;            ///< Offsets of all layouts
+        const IndexWildLink *m_WildLinks;   ///< Maps with wild Pokémon
+        const IndexString *m_MapNames;      ///< Decoded map names
+        const IndexString *m_PokemonNames;  ///< Decoded Pokémon names
+        const IndexString *m_ItemNames;     ///< Decoded item names
+        const UInt16 *m_Chars;              ///< Characters of all names
+    };
+}
+
+
+#endif // __AME_INDEXCACHE_HPP__
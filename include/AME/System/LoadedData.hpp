@@ -39,7 +39,8 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomData.hpp>
+#include <AME/System/FreespaceIndex.hpp>
 #include <AME/Structures/WildPokemonTable.hpp>
 #include <AME/Structures/PokemonTable.hpp>
 #include <AME/Structures/ItemTable.hpp>
@@ -48,6 +49,7 @@
 #include <AME/Mapping/MapBankTable.hpp>
 #include <AME/Mapping/MapNameTable.hpp>
 #include <AME/Mapping/MapLayoutTable.hpp>
+#include <AME/Mapping/LayoutManager.hpp>
 
 
 namespace ame
@@ -63,10 +65,15 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     /// \brief Loads all map-related data from the given ROM.
-    /// \returns true if no errors occured.
+    ///
+    /// The ROM file is mapped by ame::RomData and never read
+    /// as a whole.
+    ///
+    /// \param filePath Path of the ROM file
+    /// \returns the elapsed time or -1 if an error occured.
     ///
     ///////////////////////////////////////////////////////////
-    extern int loadAllMapData(const qboy::Rom &rom);
+    extern int loadAllMapData(const QString &filePath);
 
     ///////////////////////////////////////////////////////////
     /// \brief Clears all loaded map-related data.
@@ -74,6 +81,21 @@ namespace ame
     ///////////////////////////////////////////////////////////
     extern void clearAllMapData();
 
+    ///////////////////////////////////////////////////////////
+    /// \brief Saves all modified map-related data to the ROM.
+    ///
+    /// Collects the write entries of every modified layout,
+    /// every modified table of the loaded maps and the wild
+    /// Pokémon table and writes them to the ROM file at once.
+    /// The wild Pokémon table is repointed into free space if
+    /// required. Nothing is written if one of them could not
+    /// be staged.
+    ///
+    /// \returns true if the ROM file was written.
+    ///
+    ///////////////////////////////////////////////////////////
+    extern bool saveAllMapData();
+
 
     ///////////////////////////////////////////////////////////
     // Global objects
@@ -86,12 +108,18 @@ namespace ame
     extern ItemTable *dat_ItemTable;
     extern MapNameTable *dat_MapNameTable;
     extern MapLayoutTable *dat_MapLayoutTable;
+    extern RomData *dat_RomData;
+    extern FreespaceIndex *dat_FreespaceIndex;
 
 
     ///////////////////////////////////////////////////////////
     // Error messages
     //
     ///////////////////////////////////////////////////////////
+    #define LDD_ERROR_ROM       "The ROM file could not be opened for reading.\nPlease make sure that the file still exists\nand is not locked by another program."
+    #define LDD_ERROR_SAVE      "The ROM file could not be written.\nPlease make sure that the file still exists\nand is not locked by another program."
+    #define LDD_ERROR_REPOINT   "A modified table does not fit into its old location\nanymore and needs to be repointed."
+    #define LDD_ERROR_SPACE     "There is not enough free space left in the ROM\nto repoint a modified table."
 }
 
 
@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_ROMCURSOR_HPP__
+#define __AME_ROMCURSOR_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomData.hpp>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    RomCursor.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Lightweight read cursor over ame::RomData.
+    ///
+    /// Mirrors the reading interface of qboy::Rom, but every
+    /// cursor has its own position. Parsers running on
+    /// different threads each create their own cursor over
+    /// the same shared ame::RomData. Like qboy::Rom, all
+    /// reading functions are constant. Copies of a cursor
+    /// move independently of each other.
+    ///
+    ///////////////////////////////////////////////////////////
+    class RomCursor {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new cursor at the start of the given
+        /// data. The data must outlive the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        RomCursor(const RomData &data);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the underlying ROM data.
+        ///
+        ///////////////////////////////////////////////////////////
+        const RomData &data() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Moves the cursor to the given offset.
+        ///
+        /// \returns false if the offset lies outside the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool seek(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the current cursor position.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 offset() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the offset lies in the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool checkOffset(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether count bytes can be read.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool canRead(UInt32 count) const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a byte and advances the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt8 readByte() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a half-word and advances the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 readHWord() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a word and advances the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 readWord() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a pointer and advances the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 readPointer() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a pointer and remembers its location.
+        ///
+        /// The location can be retrieved by redirected(), in
+        /// order to report where an invalid pointer came from.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 readPointerRef() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads count bytes and advances the cursor.
+        ///
+        ///////////////////////////////////////////////////////////
+        QByteArray readBytes(UInt32 count) const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the location of the last pointer
+        ///        read by readPointerRef().
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 redirected() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Forgets the last pointer location.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clearCache() const;
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        const RomData *m_Data;          ///< Shared ROM contents
+        mutable UInt32 m_Offset;        ///< Current position
+        mutable UInt32 m_Redirected;    ///< Location of last pointer
+    };
+}
+
+
+#endif // __AME_ROMCURSOR_HPP__
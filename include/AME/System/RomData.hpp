@@ -0,0 +1,284 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_ROMDATA_HPP__
+#define __AME_ROMDATA_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <QBoy/Config.hpp>
+#include <AME/System/WriteEntry.hpp>
+#include <QByteArray>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QFile>
+#include <QMap>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    RomData.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Immutable snapshot of the ROM's contents.
+    ///
+    /// The ROM is never read as a whole. RomData maps the file
+    /// read-only into memory and provides
+    /// cursorless reads at a given offset, which can be safely
+    /// shared by any amount of threads. Parsers use their own
+    /// ame::RomCursor on top of it.
+    ///
+    /// Pages of the mapping are shared with the file cache of
+    /// the system, so the ROM is never copied. Edits are staged
+    /// in a copy-on-write overlay of modified pages, which does
+    /// not affect the snapshot and is written by flush().
+    ///
+    ///////////////////////////////////////////////////////////
+    class RomData {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new, empty instance of ame::RomData.
+        ///
+        ///////////////////////////////////////////////////////////
+        RomData();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ///////////////////////////////////////////////////////////
+        ~RomData();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Maps the given ROM file read-only.
+        ///
+        /// Falls back to reading the whole file if it cannot be
+        /// mapped.
+        ///
+        /// \param filePath Path of the ROM file
+        /// \returns true if the file could be read.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool load(const QString &filePath);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Unmaps the file and discards all staged edits.
+        ///
+        ///////////////////////////////////////////////////////////
+        void close();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether data has been loaded.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isLoaded() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the size of the ROM, in bytes.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 size() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves a pointer to the raw ROM bytes.
+        ///
+        ///////////////////////////////////////////////////////////
+        const UInt8 *data() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the path of the ROM file.
+        ///
+        ///////////////////////////////////////////////////////////
+        QString filePath() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the game code in the ROM header.
+        ///
+        /// The code consists of four characters, e.g. BPRE.
+        ///
+        ///////////////////////////////////////////////////////////
+        QString code() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the game title in the ROM header.
+        ///
+        ///////////////////////////////////////////////////////////
+        QString name() const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether the offset lies in the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool checkOffset(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether count bytes can be read.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool canRead(UInt32 offset, UInt32 count) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a byte at the given offset.
+        ///
+        /// Reads outside of the ROM yield zero.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt8 readByte(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a half-word at the given offset.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt16 readHWord(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a word at the given offset.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 readWord(UInt32 offset) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads a pointer at the given offset.
+        ///
+        /// Returns zero for null pointers; converts the GBA
+        /// address to a ROM offset otherwise.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 readPointer(UInt32 offset) const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Stages the given entry in the overlay.
+        ///
+        /// Every touched page is copied on its first edit. The
+        /// snapshot read by parsers is not affected.
+        ///
+        /// \returns false if the entry exceeds the ROM.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool write(const WriteEntry &entry);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Reads bytes as they would be after flush().
+        ///
+        ///////////////////////////////////////////////////////////
+        QByteArray readStaged(UInt32 offset, UInt32 count) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether any edits are staged.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isModified() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves all staged edits, one per run of
+        ///        consecutive modified pages.
+        ///
+        ///////////////////////////////////////////////////////////
+        QList<WriteEntry> changes() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Discards all staged edits.
+        ///
+        ///////////////////////////////////////////////////////////
+        void discard();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the lock guarding the mapping.
+        ///
+        /// Threads reading data() in the background, e.g. while
+        /// decoding tilesets, hold it for reading; flush() holds
+        /// it for writing while the file is remapped.
+        ///
+        ///////////////////////////////////////////////////////////
+        QReadWriteLock *mapLock() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes all staged edits to the ROM file.
+        ///
+        /// Only the modified pages are written, through an
+        /// ame::SaveEngine, so the file is replaced atomically.
+        /// The new file is mapped afterwards, which invalidates
+        /// all pointers returned by data(). The overlay is
+        /// cleared on success. Waits for all readers holding
+        /// mapLock() before the file is unmapped.
+        ///
+        /// \returns false if the file could not be written.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool flush();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Maps the given file or reads it as a whole.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool map(const QString &filePath);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Releases the mapping or the copy of the file.
+        ///
+        ///////////////////////////////////////////////////////////
+        void unmap();
+
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QFile m_File;                   ///< Mapped ROM file
+        const UInt8 *m_Data;            ///< Start of the ROM bytes
+        UInt32 m_Size;                  ///< Size of the ROM
+        QByteArray m_Buffer;            ///< Holds the ROM if not mappable
+        QMap<UInt32, QByteArray> m_Overlay; ///< Modified pages, by index
+        mutable QMutex m_OverlayLock;   ///< Guards the overlay
+        mutable QReadWriteLock m_MapLock; ///< Guards the mapping
+        QString m_FilePath;             ///< Path of the ROM file
+    };
+}
+
+
+#endif // __AME_ROMDATA_HPP__
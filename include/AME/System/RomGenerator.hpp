@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_ROMGENERATOR_HPP__
+#define __AME_ROMGENERATOR_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/Configuration.hpp>
+#include <QByteArray>
+#include <QSize>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    RomGenerator.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Generates synthetic ROM images for testing.
+    ///
+    /// Writes a structurally valid FRLG- or RSE-shaped image
+    /// that contains no copyrighted data: map banks, layouts,
+    /// tilesets, events, wild Pokémon, overworlds, Pokémon
+    /// icons and names, items and map names. The content is
+    /// pseudo-random but reproducible through the seed. The
+    /// matching configuration file is generated alongside.
+    ///
+    ///////////////////////////////////////////////////////////
+    class RomGenerator {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new instance of ame::RomGenerator that
+        /// produces a FRLG-shaped image of retail-like size.
+        ///
+        ///////////////////////////////////////////////////////////
+        RomGenerator();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Generates the image and its configuration.
+        ///
+        /// Pushes an error onto the error stack if the settings
+        /// are out of range or the image exceeds 32 MB.
+        ///
+        /// \returns false if the image could not be generated.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool generate();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes the image and the configuration file.
+        ///
+        /// \param romPath Path of the ROM file
+        /// \param configPath Path of the YAML file
+        /// \returns false if one of the files could not be written.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool save(const QString &romPath, const QString &configPath) const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the generated image.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QByteArray &image() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the generated configuration file.
+        ///
+        ///////////////////////////////////////////////////////////
+        const QByteArray &config() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the game code of the image.
+        ///
+        /// The codes are reserved for generated images and do
+        /// not collide with any retail game.
+        ///
+        ///////////////////////////////////////////////////////////
+        QString code() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the first unused offset of the image.
+        ///
+        /// Everything behind it is padded with 0xFF.
+        ///
+        ///////////////////////////////////////////////////////////
+        UInt32 freespace() const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the game the image is shaped after.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setType(BaseROMType type);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the amount of banks and their maps.
+        ///
+        /// \param banks Amount of banks, 1 to 255
+        /// \param maps Amount of maps per bank, 1 to 255
+        ///
+        ///////////////////////////////////////////////////////////
+        void setBanks(Int32 banks, Int32 maps);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the range of the map dimensions.
+        ///
+        /// Every map gets a random size within the range.
+        ///
+        /// \param min Minimum width and height in blocks
+        /// \param max Maximum width and height in blocks
+        ///
+        ///////////////////////////////////////////////////////////
+        void setMapSize(const QSize &min, const QSize &max);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the amount of tilesets.
+        ///
+        /// Maps use the tilesets in a round-robin fashion.
+        ///
+        /// \param primary Amount of primary tilesets
+        /// \param secondary Amount of secondary tilesets
+        ///
+        ///////////////////////////////////////////////////////////
+        void setTilesets(Int32 primary, Int32 secondary);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies whether tileset images are compressed.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setCompressed(bool compressed);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the amount of NPCs per map.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setNpcs(Int32 npcs);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Specifies the seed of the random content.
+        ///
+        ///////////////////////////////////////////////////////////
+        void setSeed(UInt32 seed);
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        BaseROMType m_Type;         ///< Game the image is shaped after
+        Int32 m_Banks;              ///< Amount of banks
+        Int32 m_Maps;               ///< Amount of maps per bank
+        QSize m_MinSize;            ///< Minimum map size in blocks
+        QSize m_MaxSize;            ///< Maximum map size in blocks
+        Int32 m_Primary;            ///< Amount of primary tilesets
+        Int32 m_Secondary;          ///< Amount of secondary tilesets
+        bool m_Compressed;          ///< Are tileset images compressed?
+        Int32 m_Npcs;               ///< Amount of NPCs per map
+        UInt32 m_Seed;              ///< Seed of the random content
+        UInt32 m_Freespace;         ///< First unused offset
+        QByteArray m_Image;         ///< Generated image
+        QByteArray m_Config;        ///< Generated YAML file
+    };
+
+
+    #define RGN_ERROR_BANKS     "The amount of banks and maps per bank must be between 1 and 255."
+    #define RGN_ERROR_SIZE      "The map size range is invalid; dimensions must be between 1 and 1024."
+    #define RGN_ERROR_TILESETS  "At least one primary and one secondary tileset is required."
+    #define RGN_ERROR_NPCS      "The amount of NPCs per map must be between 0 and 255."
+    #define RGN_ERROR_FULL      "The generated image exceeds the 32 MB address space."
+}
+
+
+#endif // __AME_ROMGENERATOR_HPP__
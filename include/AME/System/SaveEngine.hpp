@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_SAVEENGINE_HPP__
+#define __AME_SAVEENGINE_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/WriteEntry.hpp>
+#include <QList>
+#include <QString>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \file    SaveEngine.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Writes a set of write entries transactionally.
+    ///
+    /// The entries of all modified structures are collected,
+    /// sorted and merged into as few ranges as possible. Only
+    /// these ranges are written to a copy of the ROM, which
+    /// then replaces the file atomically. The ROM is therefore
+    /// either saved completely or not touched at all.
+    ///
+    /// The copy is cloned by the file system where possible,
+    /// so that saving costs about as much as the modified
+    /// bytes, not the whole file.
+    ///
+    ///////////////////////////////////////////////////////////
+    class SaveEngine {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Initializes a new, empty instance of ame::SaveEngine.
+        ///
+        ///////////////////////////////////////////////////////////
+        SaveEngine();
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Adds an entry to the transaction.
+        ///
+        /// Overlapping entries are allowed; the bytes of the one
+        /// added last are written.
+        ///
+        ///////////////////////////////////////////////////////////
+        void add(const WriteEntry &entry);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Adds all entries of a structure.
+        ///
+        ///////////////////////////////////////////////////////////
+        void add(const QList<WriteEntry> &entries);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Removes all entries.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clear();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether there is anything to write.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Sorts and merges all entries.
+        ///
+        /// \returns disjoint entries in ascending order, where
+        ///          adjacent and overlapping ones are merged.
+        ///
+        ///////////////////////////////////////////////////////////
+        QList<WriteEntry> coalesce() const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes all entries to the given file.
+        ///
+        /// The file must not be mapped or opened for writing by
+        /// anyone else. The entries are cleared on success.
+        ///
+        /// \param filePath Path to the ROM file
+        /// \returns false if the file could not be replaced;
+        ///          it is left unchanged in this case.
+        ///
+        ///////////////////////////////////////////////////////////
+        bool commit(const QString &filePath);
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        QList<WriteEntry> m_Entries;    ///< Entries in order of addition
+    };
+
+
+    #define SE_ERROR_OPEN       "The ROM file could not be opened for saving."
+    #define SE_ERROR_RANGE      "A modified range (ref: 0x%offset%) exceeds the ROM file."
+    #define SE_ERROR_TEMP       "The temporary file next to the ROM could not be created."
+    #define SE_ERROR_COPY       "The ROM file could not be copied to the temporary file."
+    #define SE_ERROR_WRITE      "The modified range at 0x%offset% could not be written."
+    #define SE_ERROR_SYNC       "The temporary file could not be written to the disk."
+    #define SE_ERROR_REPLACE    "The ROM file could not be replaced by the saved copy."
+}
+
+
+#endif // __AME_SAVEENGINE_HPP__
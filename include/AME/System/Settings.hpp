@@ -100,6 +100,7 @@ namespace ame
         static bool ShowRawLayoutHeader;
         static bool ShowGrid;
         static int MapAccuracyLevel;
+        static bool TraceLoading;
         static QList<QString> RecentFiles;
 		static float ScaleFactor;
     };
@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef __AME_TRACER_HPP__
+#define __AME_TRACER_HPP__
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <QBoy/Config.hpp>
+#include <QElapsedTimer>
+#include <QAtomicInt>
+#include <QMutex>
+#include <QHash>
+#include <QList>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    /// \struct  TraceEvent
+    /// \brief   Holds a single recorded timing span.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TraceEvent
+    {
+        const char *category;   ///< Phase the span belongs to
+        QString name;           ///< Describes the traced work
+        qint64 begin;           ///< Start, in ns since tracing began
+        qint64 end;             ///< End, in ns since tracing began
+        Int32 thread;           ///< Index of the recording thread
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \file    Tracer.hpp
+    /// \author  agent
+    /// \version 1.0.0.0
+    /// \date    10/17/2026
+    /// \brief   Records timing spans of the loading process.
+    ///
+    /// Spans are recorded through AME_TRACE from any thread
+    /// while the tracer is active and can be written as Chrome
+    /// trace JSON, which chrome://tracing and Perfetto open.
+    ///
+    ///////////////////////////////////////////////////////////
+    class Tracer {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Discards all spans and starts recording.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void start();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Stops recording; the spans are kept.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void stop();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Determines whether spans are being recorded.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool isActive();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the nanoseconds since start().
+        ///
+        ///////////////////////////////////////////////////////////
+        static qint64 now();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Records a finished span of the current thread.
+        ///
+        ///////////////////////////////////////////////////////////
+        static void record(const char *category, const QString &name, qint64 begin, qint64 end);
+
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Summarizes the recorded spans per phase.
+        ///
+        /// Lists the amount of spans, the total and the longest
+        /// duration of every category, one category per line.
+        ///
+        ///////////////////////////////////////////////////////////
+        static QString summary();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Writes all spans as Chrome trace JSON.
+        ///
+        /// The per-phase summary is stored in "otherData".
+        ///
+        /// \param filePath Path of the JSON file to create
+        /// \returns false if the file could not be written.
+        ///
+        ///////////////////////////////////////////////////////////
+        static bool write(const QString &filePath);
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Static class members
+        //
+        ///////////////////////////////////////////////////////////
+        static QList<TraceEvent> m_Events;       ///< Holds all recorded spans
+        static QHash<Qt::HANDLE, Int32> m_Threads; ///< Maps threads to indices
+        static QElapsedTimer m_Clock;            ///< Measures since start()
+        static QAtomicInt m_Active;              ///< Is recording enabled?
+        static QMutex m_Mutex;                   ///< Guards events and threads
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    /// \class   TraceSpan
+    /// \brief   Records the lifetime of a scope as a span.
+    ///
+    ///////////////////////////////////////////////////////////
+    class TraceSpan {
+    public:
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Starts the span if the tracer is active.
+        ///
+        ///////////////////////////////////////////////////////////
+        TraceSpan(const char *category, const QString &name);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Records the span if it was started.
+        ///
+        ///////////////////////////////////////////////////////////
+        ~TraceSpan();
+
+
+    private:
+
+        ///////////////////////////////////////////////////////////
+        // Class members
+        //
+        ///////////////////////////////////////////////////////////
+        const char *m_Category;     ///< Phase the span belongs to
+        QString m_Name;             ///< Describes the traced work
+        qint64 m_Begin;             ///< Start of the span, or -1
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Traces the current scope; the name is only evaluated
+    // while the tracer is active
+    //
+    ///////////////////////////////////////////////////////////
+    #define AME_TRACE_JOIN2(a, b)   a##b
+    #define AME_TRACE_JOIN(a, b)    AME_TRACE_JOIN2(a, b)
+    #define AME_TRACE(cat, name)    ame::TraceSpan AME_TRACE_JOIN(ameTrace, __LINE__) \
+                                        (cat, ame::Tracer::isActive() ? QString(name) : QString())
+}
+
+
+#endif // __AME_TRACER_HPP__
@@ -39,7 +39,7 @@
 // Include files
 //
 ///////////////////////////////////////////////////////////
-#include <QBoy/Core/Rom.hpp>
+#include <AME/System/RomCursor.hpp>
 
 
 namespace ame
@@ -69,7 +69,7 @@ namespace ame
         /// \returns a readable string representation.
         ///
         ///////////////////////////////////////////////////////////
-        static const QString read(const qboy::Rom &rom, UInt32 offset);
+        static const QString read(const RomCursor &rom, UInt32 offset);
 
         ///////////////////////////////////////////////////////////
         // * Write yet to be implemented! *                      //
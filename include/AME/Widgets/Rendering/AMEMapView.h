@@ -43,6 +43,7 @@
 #include <QVector>
 #include <QRgb>
 #include <AME/System/LoadedData.hpp>
+#include <AME/Graphics/BlocksetCache.hpp>
 #include <AME/Widgets/Listeners/MovePermissionListener.h>
 #include <AME/Widgets/Rendering/Cursor.hpp>
 #include <AME/Mapping/CurrentMapManager.hpp>
@@ -93,7 +94,7 @@ namespace ame
         /// \returns true if loading succeeded.
         ///
         ///////////////////////////////////////////////////////////
-        bool setMap(const qboy::Rom &rom, Map *map);
+        bool setMap(Map *map);
 
         ///////////////////////////////////////////////////////////
         /// \brief Sets the map layout only to be loaded
@@ -221,9 +222,55 @@ namespace ame
         ///////////////////////////////////////////////////////////
         /// \brief Changes a block in both the map data and image.
         ///
+        /// Between beginEdit() and endEdit(), only the map data
+        /// is changed; the images are updated by endEdit().
+        ///
         ///////////////////////////////////////////////////////////
         bool placeBlock(int x, int y, MapBlock newBlock);
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Starts collecting block changes.
+        ///
+        /// Strokes, stamps and fills should wrap their calls to
+        /// placeBlock() in beginEdit() and endEdit(). Edits may
+        /// be nested; only the outermost endEdit() applies them.
+        ///
+        ///////////////////////////////////////////////////////////
+        void beginEdit();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Applies all collected block changes.
+        ///
+        /// Draws the changed blocks to the map images in one pass,
+        /// uploads the changed area once per layer and repaints
+        /// the union of all changes.
+        ///
+        ///////////////////////////////////////////////////////////
+        void endEdit();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Fills the area connected to the given block.
+        ///
+        /// Tiles the pattern over the area, starting at \p pos;
+        /// in movement mode, permissions are matched instead of
+        /// blocks. The change is applied as one edit.
+        ///
+        /// \returns the changed blocks, or a null rectangle.
+        ///
+        ///////////////////////////////////////////////////////////
+        QRect fill(const QPoint &pos, const QVector<MapBlock> &pattern, const QSize &patternSize);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Replaces all blocks that match the given one.
+        ///
+        /// Works like fill(), but on the whole map; only the
+        /// replaced blocks are drawn again.
+        ///
+        /// \returns the changed blocks, or a null rectangle.
+        ///
+        ///////////////////////////////////////////////////////////
+        QRect fillAll(const QPoint &pos, const QVector<MapBlock> &pattern, const QSize &patternSize);
+
         ///////////////////////////////////////////////////////////
         /// \brief Sets the visibility of the grid from the UI.
         ///
@@ -285,6 +332,65 @@ namespace ame
 
     private:
 
+        ///////////////////////////////////////////////////////////
+        /// \brief Discards all maps and their pixel buffers.
+        ///
+        /// Called before a new map or layout is shown, so that
+        /// nothing of the previous one is drawn or edited.
+        ///
+        ///////////////////////////////////////////////////////////
+        void clearMaps();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Retrieves the header that is being edited.
+        ///
+        /// This is the layout in the layout view and the header
+        /// of the main map otherwise; NULL if nothing is shown.
+        ///
+        ///////////////////////////////////////////////////////////
+        MapHeader *editedHeader();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Discards all view tiles and sizes the tile grid.
+        ///
+        /// The widget is split into square tiles that hold the
+        /// composed map and connection images; they are composed
+        /// lazily the first time they are exposed.
+        ///
+        ///////////////////////////////////////////////////////////
+        void resetTiles();
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Composes a single view tile.
+        ///
+        ///////////////////////////////////////////////////////////
+        void composeTile(Int32 index);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Converts blocks of the main map to widget pixels.
+        ///
+        ///////////////////////////////////////////////////////////
+        QRect blockRect(const QRect &blocks) const;
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Marks the tiles of the given blocks as dirty.
+        ///
+        /// Schedules a repaint of the affected area only.
+        ///
+        ///////////////////////////////////////////////////////////
+        void invalidateBlocks(const QRect &blocks);
+
+        ///////////////////////////////////////////////////////////
+        /// \brief Draws permissions to the cached overlay layer.
+        ///
+        /// Creates the layer for the whole main map first, if
+        /// it does not exist yet; otherwise only the given blocks
+        /// are drawn again.
+        ///
+        ///////////////////////////////////////////////////////////
+        void renderPermissions(const QRect &blocks);
+
+
         ///////////////////////////////////////////////////////////
         // Class members
         //
@@ -308,20 +414,20 @@ namespace ame
         QList<QImage> m_ConnMapFore;
         QList<QImage> m_ConnMapBack;
         QList<QImage> m_ConnImages;
+        QVector<QPixmap> m_Tiles;
+        QBitArray m_DirtyTiles;
+        Int32 m_TileColumns;
         QList<UInt8 *> m_BackPixelBuffers;
         QList<UInt8 *> m_ForePixelBuffers;
         QSize m_PrimarySetSize;
         QSize m_SecondarySetSize;
         QSize m_WidgetSize;
-        UInt8 *m_PrimaryForeground;
-        UInt8 *m_PrimaryBackground;
-        UInt8 *m_SecondaryForeground;
-        UInt8 *m_SecondaryBackground;
+        Blockset m_Blockset;
         Int32 m_PrimaryBlockCount;
         Int32 m_SecondaryBlockCount;
         Boolean m_ShowSprites;
         Boolean m_LayoutView;
-        MapHeader m_Header;
+        MapHeader *m_Header;
         Boolean m_MovementMode;
         AMEBlockView *m_BlockView;
         MovePermissionListener *m_MPListener;
@@ -332,6 +438,10 @@ namespace ame
         QSize m_SelectSize;
         Cursor::Tool m_CurrentTool;
         QImage m_MovePerm;
+        QPixmap m_PermLayer;
+        QVector<Int32> m_EditCells;
+        QRect m_EditRect;
+        Int32 m_EditDepth;
         Boolean m_ShowCursor;
         Boolean m_ShowGrid;
         Boolean m_IsInit;
@@ -0,0 +1,365 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Algorithm/Lz77.hpp>
+#include <QElapsedTimer>
+#include <QVector>
+#include <cstring>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Stream format
+    //
+    ///////////////////////////////////////////////////////////
+    #define LZ77_MAGIC          0x10
+    #define LZ77_MIN_MATCH      3
+    #define LZ77_MAX_MATCH      18
+    #define LZ77_MIN_DISP       2
+    #define LZ77_MAX_DISP       4096
+    #define LZ77_HASH_BITS      13
+    #define LZ77_MAX_CHAIN      128
+    #define LZ77_COPY_SLACK     8
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_LZ_Hash(const UInt8 *data)
+    {
+        UInt32 key = data[0] | (data[1] << 8) | (data[2] << 16);
+        return (key * 2654435761U) >> (32 - LZ77_HASH_BITS);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 Lz77::decompressedSize(const UInt8 *src, UInt32 size)
+    {
+        if (size < 4 || src[0] != LZ77_MAGIC)
+            return -1;
+
+        return src[1] | (src[2] << 8) | (src[3] << 16);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Blocks consisting of eight literals are copied at once.
+    // Back references at least eight bytes behind are copied
+    // in eight-byte chunks, which may write past the end of
+    // the match; the destination therefore has some slack
+    // that is cut off once decoding is done.
+    //
+    ///////////////////////////////////////////////////////////
+    bool Lz77::decompress(const UInt8 *src, UInt32 size, QByteArray &dest, UInt32 *read)
+    {
+        Int32 length = decompressedSize(src, size);
+        if (length < 0)
+            return false;
+
+        dest.resize(length + LZ77_COPY_SLACK);
+        UInt8 *out = reinterpret_cast<UInt8 *>(dest.data());
+        const UInt8 *in = src + 4;
+        const UInt8 *end = src + size;
+        UInt32 pos = 0;
+
+        while (pos < (UInt32)length)
+        {
+            if (in >= end)
+                return false;
+
+            UInt32 flags = *in++;
+            if (flags == 0 && end - in >= 8 && length - pos >= 8)
+            {
+                std::memcpy(out + pos, in, 8);
+                in += 8;
+                pos += 8;
+                continue;
+            }
+
+            for (int bit = 0; bit < 8 && pos < (UInt32)length; bit++, flags <<= 1)
+            {
+                if ((flags & 0x80) == 0)
+                {
+                    if (in >= end)
+                        return false;
+
+                    out[pos++] = *in++;
+                    continue;
+                }
+
+                if (end - in < 2)
+                    return false;
+
+                UInt32 count = (in[0] >> 4) + LZ77_MIN_MATCH;
+                UInt32 disp = (((in[0] & 0xF) << 8) | in[1]) + 1;
+                in += 2;
+
+                if (disp > pos)
+                    return false;
+                if (count > length - pos)
+                    count = length - pos;
+
+                UInt8 *target = out + pos;
+                const UInt8 *source = target - disp;
+                if (disp >= 8)
+                {
+                    for (UInt32 i = 0; i < count; i += 8)
+                        std::memcpy(target + i, source + i, 8);
+                }
+                else if (disp == 1)
+                {
+                    std::memset(target, *source, count);
+                }
+                else
+                {
+                    for (UInt32 i = 0; i < count; i++)
+                        target[i] = source[i];
+                }
+
+                pos += count;
+            }
+        }
+
+        dest.resize(length);
+        if (read != NULL)
+            *read = in - src;
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool Lz77::decompress(const RomData &rom, UInt32 offset, QByteArray &dest)
+    {
+        if (!rom.checkOffset(offset))
+            return false;
+
+        return decompress(rom.data() + offset, rom.size() - offset, dest);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Matches are found through hash chains over the previous
+    // 4096 bytes; every position is inserted into its chain,
+    // including the ones covered by a back reference.
+    //
+    ///////////////////////////////////////////////////////////
+    QByteArray Lz77::compress(const QByteArray &src)
+    {
+        const UInt8 *data = reinterpret_cast<const UInt8 *>(src.constData());
+        const UInt32 size = src.size();
+
+        // Worst case: every byte is a literal
+        QByteArray dest;
+        dest.resize(4 + size + (size + 7) / 8 + 3);
+        UInt8 *out = reinterpret_cast<UInt8 *>(dest.data());
+        out[0] = LZ77_MAGIC;
+        out[1] = (size & 0xFF);
+        out[2] = ((size >> 8) & 0xFF);
+        out[3] = ((size >> 16) & 0xFF);
+
+        QVector<Int32> head(1 << LZ77_HASH_BITS, -1);
+        QVector<Int32> prev(size, -1);
+        UInt32 outPos = 4;
+        UInt32 pos = 0;
+
+        while (pos < size)
+        {
+            UInt32 flagPos = outPos++;
+            UInt8 flags = 0;
+
+            for (int bit = 0; bit < 8 && pos < size; bit++)
+            {
+                UInt32 bestCount = 0;
+                UInt32 bestDisp = 0;
+                UInt32 maxCount = qMin<UInt32>(LZ77_MAX_MATCH, size - pos);
+
+                // Walks the chain of previous positions with the same hash
+                if (maxCount >= LZ77_MIN_MATCH)
+                {
+                    Int32 candidate = head.at(AME_LZ_Hash(data + pos));
+                    for (int depth = 0; candidate >= 0 && depth < LZ77_MAX_CHAIN; depth++)
+                    {
+                        UInt32 disp = pos - candidate;
+                        if (disp > LZ77_MAX_DISP)
+                            break;
+
+                        if (disp >= LZ77_MIN_DISP)
+                        {
+                            UInt32 count = 0;
+                            while (count < maxCount && data[candidate + count] == data[pos + count])
+                                count++;
+
+                            if (count > bestCount)
+                            {
+                                bestCount = count;
+                                bestDisp = disp;
+                                if (count == maxCount)
+                                    break;
+                            }
+                        }
+
+                        candidate = prev.at(candidate);
+                    }
+                }
+
+                UInt32 advance = 1;
+                if (bestCount >= LZ77_MIN_MATCH)
+                {
+                    flags |= (0x80 >> bit);
+                    out[outPos++] = (((bestCount - LZ77_MIN_MATCH) << 4) | ((bestDisp - 1) >> 8));
+                    out[outPos++] = ((bestDisp - 1) & 0xFF);
+                    advance = bestCount;
+                }
+                else
+                {
+                    out[outPos++] = data[pos];
+                }
+
+                // Registers all consumed positions in the hash chains
+                for (UInt32 i = 0; i < advance; i++, pos++)
+                {
+                    if (pos + LZ77_MIN_MATCH > size)
+                        continue;
+
+                    UInt32 hash = AME_LZ_Hash(data + pos);
+                    prev[pos] = head.at(hash);
+                    head[hash] = pos;
+                }
+            }
+
+            out[flagPos] = flags;
+        }
+
+        // Pads the stream to a multiple of four bytes
+        while (outPos % 4 != 0)
+            out[outPos++] = 0;
+
+        dest.resize(outPos);
+        return dest;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Lz77Benchmark Lz77::benchmark(const RomData &rom, const QList<UInt32> &offsets, Int32 rounds)
+    {
+        Lz77Benchmark result;
+        result.payloads = 0;
+        result.compressedBytes = 0;
+        result.decompressedBytes = 0;
+        result.recompressedBytes = 0;
+        result.decodeSpeed = 0.0;
+        result.encodeSpeed = 0.0;
+        result.roundTrip = true;
+
+        qint64 decodeTime = 0;
+        qint64 encodeTime = 0;
+        QElapsedTimer timer;
+
+        foreach (UInt32 offset, offsets)
+        {
+            QByteArray original;
+            UInt32 read = 0;
+            if (!rom.checkOffset(offset) ||
+                !decompress(rom.data() + offset, rom.size() - offset, original, &read))
+                continue;
+
+            QByteArray decoded;
+            timer.start();
+            for (int i = 0; i < rounds; i++)
+                decompress(rom.data() + offset, read, decoded);
+            decodeTime += timer.nsecsElapsed();
+
+            QByteArray encoded;
+            timer.start();
+            for (int i = 0; i < rounds; i++)
+                encoded = compress(original);
+            encodeTime += timer.nsecsElapsed();
+
+            if (!decompress(reinterpret_cast<const UInt8 *>(encoded.constData()), encoded.size(), decoded) ||
+                decoded != original)
+                result.roundTrip = false;
+
+            result.payloads++;
+            result.compressedBytes += read;
+            result.decompressedBytes += original.size();
+            result.recompressedBytes += encoded.size();
+        }
+
+        // Converts bytes per nanosecond to megabytes per second
+        double total = (double)result.decompressedBytes * rounds * 1000.0;
+        if (decodeTime > 0)
+            result.decodeSpeed = total / decodeTime;
+        if (encodeTime > 0)
+            result.encodeSpeed = total / encodeTime;
+
+        return result;
+    }
+}
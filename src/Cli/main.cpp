@@ -0,0 +1,549 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Algorithm/Lz77.hpp>
+#include <AME/Graphics/BlocksetCache.hpp>
+#include <AME/Graphics/MapRenderer.hpp>
+#include <AME/Mapping/BlockReplace.hpp>
+#include <AME/Mapping/MapFill.hpp>
+#include <AME/System/Configuration.hpp>
+#include <AME/System/ErrorStack.hpp>
+#include <AME/System/LoadedData.hpp>
+#include <AME/System/RomGenerator.hpp>
+#include <AME/System/Settings.hpp>
+#include <AME/System/Tracer.hpp>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QFutureSynchronizer>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QDir>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline QTextStream &AME_CLI_Out()
+    {
+        static QTextStream stream(stdout);
+        return stream;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_CLI_PrintStats()
+    {
+        QTextStream &out = AME_CLI_Out();
+
+        // Banks and maps
+        Int32 mapCount = 0;
+        for (int i = 0; i < dat_MapBankTable->banks().size(); i++)
+        {
+            const MapBank *bank = dat_MapBankTable->banks().at(i);
+            out << QString("Bank %1 (0x%2): %3 maps\n").arg(i).arg(bank->offset(), 0, 16).arg(bank->maps().size());
+            mapCount += bank->maps().size();
+        }
+
+        // Layouts and their area
+        Int32 layoutCount = 0;
+        qint64 blockCount = 0;
+        foreach (const MapHeader *header, dat_MapLayoutTable->mapHeaders())
+        {
+            if (header->offset() == 0)
+                continue;
+
+            layoutCount++;
+            blockCount += header->size().width() * header->size().height();
+        }
+
+        // Tilesets and their memory usage
+        Int32 decoded = 0;
+        qint64 resident = 0;
+        Int32 compressed = 0;
+        const QList<TilesetUsage> usages = TilesetManager::usages();
+        foreach (const TilesetUsage &usage, usages)
+        {
+            if (usage.tileset->isDecoded())
+                decoded++;
+            if (usage.tileset->isCompressed())
+                compressed++;
+
+            resident += usage.residentBytes;
+        }
+
+        out << QString("Banks:    %1\n").arg(dat_MapBankTable->banks().size());
+        out << QString("Maps:     %1\n").arg(mapCount);
+        out << QString("Layouts:  %1 (%2 blocks)\n").arg(layoutCount).arg(blockCount);
+        out << QString("Tilesets: %1 (%2 compressed, %3 decoded, %4 KB resident)\n")
+               .arg(usages.size()).arg(compressed).arg(decoded).arg(resident / 1024);
+        out << QString("Tileset lookups: %1 hits, %2 misses\n")
+               .arg(TilesetManager::hits()).arg(TilesetManager::misses());
+        out << QString("Blockset cache: %1 hits, %2 misses, %3 KB resident\n")
+               .arg(BlocksetCache::hits()).arg(BlocksetCache::misses()).arg(BlocksetCache::residentBytes() / 1024);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every map is loaded and rendered on the global thread
+    // pool; the files are named <bank>.<map>.png.
+    //
+    ///////////////////////////////////////////////////////////
+    inline Int32 AME_CLI_RenderMaps(const QString &folder)
+    {
+        QFutureSynchronizer<bool> tasks;
+        for (int i = 0; i < dat_MapBankTable->banks().size(); i++)
+        {
+            const QList<Map *> &maps = dat_MapBankTable->banks().at(i)->maps();
+            for (int j = 0; j < maps.size(); j++)
+            {
+                Map *map = maps.at(j);
+                const QString filePath = folder + QString("/%1.%2.png").arg(i).arg(j);
+
+                tasks.addFuture(QtConcurrent::run([map, filePath]() {
+                    AME_TRACE("render", filePath);
+                    if (!map->load(RomCursor(*dat_RomData)))
+                        return false;
+
+                    const QImage image = MapRenderer::render(map->header());
+                    return (!image.isNull() && image.save(filePath));
+                }));
+            }
+        }
+
+        tasks.waitForFinished();
+
+        Int32 failed = 0;
+        foreach (const QFuture<bool> &task, tasks.futures())
+            if (!task.result())
+                failed++;
+
+        return failed;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline QSize AME_CLI_Size(const QString &value)
+    {
+        const QStringList parts = value.toLower().split('x');
+        if (parts.size() != 2)
+            return QSize();
+
+        return QSize(parts.at(0).toInt(), parts.at(1).toInt());
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The configuration file is written to the config folder
+    // of the tool, so that the ROM can be loaded right away.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_CLI_Generate(const QCommandLineParser &parser, const QString &filePath)
+    {
+        RomGenerator generator;
+        const QString game = parser.value("game").toLower();
+        if (game == "rs")
+            generator.setType(RT_RS);
+        else if (game == "em")
+            generator.setType(RT_EM);
+        else
+            generator.setType(RT_FRLG);
+
+        generator.setBanks(parser.value("banks").toInt(), parser.value("maps").toInt());
+        generator.setMapSize(AME_CLI_Size(parser.value("size")), AME_CLI_Size(parser.value("max-size")));
+        generator.setTilesets(parser.value("primary").toInt(), parser.value("secondary").toInt());
+        generator.setCompressed(!parser.isSet("uncompressed"));
+        generator.setNpcs(parser.value("npcs").toInt());
+        generator.setSeed(parser.value("seed").toUInt());
+
+        QElapsedTimer timer;
+        timer.start();
+        if (!generator.generate())
+            return false;
+
+        const QString configPath = Configuration::filePath(generator.code());
+        if (!generator.save(filePath, configPath))
+            return ErrorStack::add(Q_FUNC_INFO, QString("Could not write %1 or %2.").arg(filePath, configPath));
+
+        AME_CLI_Out() << QString("Generated %1 (%2 KB used, %3 KB total) and %4 in %5 ms\n")
+                         .arg(filePath).arg(generator.freespace() / 1024).arg(generator.image().size() / 1024)
+                         .arg(configPath).arg(timer.elapsed());
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_CLI_BenchmarkLz77(Int32 rounds)
+    {
+        QList<UInt32> offsets;
+        foreach (const TilesetUsage &usage, TilesetManager::usages())
+            if (usage.tileset->isCompressed())
+                offsets.push_back(usage.tileset->imageOffset());
+
+        const Lz77Benchmark result = Lz77::benchmark(*dat_RomData, offsets, rounds);
+
+        QTextStream &out = AME_CLI_Out();
+        out << QString("LZ77 payloads:  %1\n").arg(result.payloads);
+        out << QString("LZ77 sizes:     %1 compressed, %2 decompressed, %3 recompressed\n")
+               .arg(result.compressedBytes).arg(result.decompressedBytes).arg(result.recompressedBytes);
+        out << QString("LZ77 decode:    %1 MB/s\n").arg(result.decodeSpeed, 0, 'f', 1);
+        out << QString("LZ77 encode:    %1 MB/s\n").arg(result.encodeSpeed, 0, 'f', 1);
+        out << QString("LZ77 roundtrip: %1\n").arg(result.roundTrip ? "ok" : "FAILED");
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Uses the tilesets of the first layout that has both.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_CLI_BenchmarkTiles(Int32 rounds)
+    {
+        QTextStream &out = AME_CLI_Out();
+        foreach (const MapHeader *header, dat_MapLayoutTable->mapHeaders())
+        {
+            if (header->primary() == NULL || header->secondary() == NULL)
+                continue;
+
+            const TileBenchmark result = MapRenderer::benchmark(header->primary(), header->secondary(), rounds);
+            out << QString("Tile layout:    0x%1 (%2 tiles)\n").arg(header->offset(), 0, 16).arg(result.tiles);
+            out << QString("Tile reference: %1 Mtiles/s\n").arg(result.referenceSpeed, 0, 'f', 1);
+            out << QString("Tile kernel:    %1 Mtiles/s\n").arg(result.kernelSpeed, 0, 'f', 1);
+            out << QString("Tile output:    %1\n").arg(result.identical ? "identical" : "MISMATCH");
+            return;
+        }
+
+        out << "Tile benchmark: no layout with both tilesets\n";
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Uses the layout with the most blocks.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_CLI_BenchmarkFill(Int32 rounds)
+    {
+        const MapHeader *largest = NULL;
+        foreach (const MapHeader *header, dat_MapLayoutTable->mapHeaders())
+            if (header->offset() != 0 && (largest == NULL || header->blocks().size() > largest->blocks().size()))
+                largest = header;
+
+        QTextStream &out = AME_CLI_Out();
+        if (largest == NULL)
+        {
+            out << "Fill benchmark: no layout\n";
+            return;
+        }
+
+        const FillBenchmark result = MapFill::benchmark(largest->blocks(), rounds);
+        out << QString("Fill layout:    0x%1 (%2x%3, %4 matches)\n").arg(largest->offset(), 0, 16)
+               .arg(largest->blocks().width()).arg(largest->blocks().height()).arg(result.matches);
+        out << QString("Fill reference: %1 Mcells/s\n").arg(result.referenceSpeed, 0, 'f', 1);
+        out << QString("Fill replace:   %1 Mcells/s\n").arg(result.replaceSpeed, 0, 'f', 1);
+        out << QString("Fill output:    %1\n").arg(result.identical ? "identical" : "MISMATCH");
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_CLI_PrintFreespace()
+    {
+        QTextStream &out = AME_CLI_Out();
+        out << QString("Free space:     %1 KB in %2 ranges from 0x%3\n").arg(dat_FreespaceIndex->totalSize() / 1024)
+               .arg(dat_FreespaceIndex->ranges().size()).arg(CONFIG(FreespaceStart) & 0x1FFFFFF, 0, 16);
+        out << QString("Largest range:  %1 KB\n").arg(dat_FreespaceIndex->largestSize() / 1024);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Parses "<block>:<new>" in hexadecimal, where "*" stands
+    // for any block or for keeping the block.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_CLI_ParseRule(const QCommandLineParser &parser, ReplaceRule &rule)
+    {
+        const QStringList blocks = parser.value("replace").split(':');
+        const QStringList perms = parser.value("replace-permission").split(':');
+        if (blocks.size() != 2 || (parser.isSet("replace-permission") && perms.size() != 2))
+            return false;
+
+        bool ok = true;
+        Int16 *fields[4] = { &rule.block, &rule.replacement.block, &rule.permission, &rule.replacement.permission };
+        const QStringList values = QStringList() << blocks << (parser.isSet("replace-permission") ? perms : QStringList() << "*" << "*");
+        for (int i = 0; i < 4 && ok; i++)
+            *fields[i] = (values.at(i) == "*") ? -1 : static_cast<Int16>(values.at(i).toUShort(&ok, 16));
+
+        rule.tileset = parser.value("replace-tileset").toUInt(&ok, 16);
+        return ok;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Prints the changed cells per layout and, if requested,
+    // writes all of them back to the ROM in one go.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_CLI_Replace(const QCommandLineParser &parser)
+    {
+        QTextStream &out = AME_CLI_Out();
+        ReplaceRule rule;
+        if (!AME_CLI_ParseRule(parser, rule))
+        {
+            out << "Replace: invalid rule\n";
+            return false;
+        }
+
+        BlockReplace replace(rule);
+        const QList<MapHeader *> &headers = dat_MapLayoutTable->mapHeaders();
+        const QList<ReplaceCount> counts = replace.preview(headers);
+
+        Int32 total = 0;
+        foreach (const ReplaceCount &count, counts)
+        {
+            out << QString("Replace layout: 0x%1 (%2 cells)\n").arg(count.header->offset(), 0, 16).arg(count.cells);
+            total += count.cells;
+        }
+
+        out << QString("Replace total:  %1 cells in %2 layouts\n").arg(total).arg(counts.size());
+        if (!parser.isSet("apply") || total == 0)
+            return true;
+
+        replace.apply(headers);
+
+        QElapsedTimer timer;
+        timer.start();
+        if (!saveAllMapData())
+        {
+            out << ErrorStack::log() << "\n";
+            return false;
+        }
+
+        out << QString("Replace saved:  %1 layouts in %2 ms\n").arg(replace.layoutCount()).arg(timer.elapsed());
+        return true;
+    }
+}
+
+
+///////////////////////////////////////////////////////////
+/// \brief Main entry point of the command-line tool
+///
+/// Opens the given ROM without any user interface, prints
+/// the load timings per phase and optionally renders all
+/// maps, dumps statistics and benchmarks the LZ77 codec,
+/// the tile drawing and the block replacing. Replaces
+/// blocks across all layouts on request.
+/// Can also generate a synthetic ROM to open instead.
+///
+/// \param argc Argument count
+/// \param argv Argument array
+///
+///////////////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+    using namespace ame;
+
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setOrganizationName("DoMoreAwesome");
+    QCoreApplication::setOrganizationDomain("domoreaweso.me");
+    QCoreApplication::setApplicationName("ame-cli");
+    QCoreApplication::setApplicationVersion("1.0");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Awesome Map Editor - headless loader and exporter.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("file", QObject::tr("The ROM file to open; defaults to the generated one."));
+
+    parser.addOptions({
+        { { "r", "render" }, QObject::tr("Renders every map as PNG into <folder>."), QObject::tr("folder") },
+        { { "s", "stats" }, QObject::tr("Prints bank, map and tileset statistics.") },
+        { { "l", "lz77" }, QObject::tr("Benchmarks the LZ77 codec on all compressed tileset images.") },
+        { "rounds", QObject::tr("Repetitions per payload of the LZ77 benchmark."), QObject::tr("count"), "3" },
+        { "tiles", QObject::tr("Benchmarks tile drawing against the per-pixel reference.") },
+        { "tile-rounds", QObject::tr("Repetitions of the tile benchmark."), QObject::tr("count"), "200" },
+        { "fill", QObject::tr("Benchmarks replacing all blocks on the largest layout.") },
+        { "fill-rounds", QObject::tr("Repetitions of the fill benchmark."), QObject::tr("count"), "100" },
+        { "replace", QObject::tr("Counts the cells of all layouts where <block> would become <new>, in hex; * matches any."), QObject::tr("block:new") },
+        { "replace-permission", QObject::tr("Restricts --replace to <perm> and sets <new> as permission, in hex."), QObject::tr("perm:new") },
+        { "replace-tileset", QObject::tr("Restricts --replace to layouts using the tileset at <offset>, in hex."), QObject::tr("offset"), "0" },
+        { "apply", QObject::tr("Applies --replace to all layouts and saves the ROM.") },
+        { "freespace", QObject::tr("Prints the free space found from the configured start.") },
+        { { "t", "trace" }, QObject::tr("Writes all timing spans as Chrome trace JSON to <file>."), QObject::tr("file") },
+        { { "g", "generate" }, QObject::tr("Generates a synthetic ROM at <file> and its configuration file."), QObject::tr("file") },
+        { "game", QObject::tr("Game the generated ROM is shaped after: frlg, rs or em."), QObject::tr("game"), "frlg" },
+        { "banks", QObject::tr("Amount of generated banks."), QObject::tr("count"), "43" },
+        { "maps", QObject::tr("Amount of generated maps per bank."), QObject::tr("count"), "10" },
+        { "size", QObject::tr("Minimum size of generated maps, in blocks."), QObject::tr("WxH"), "20x20" },
+        { "max-size", QObject::tr("Maximum size of generated maps, in blocks."), QObject::tr("WxH"), "60x60" },
+        { "primary", QObject::tr("Amount of generated primary tilesets."), QObject::tr("count"), "4" },
+        { "secondary", QObject::tr("Amount of generated secondary tilesets."), QObject::tr("count"), "40" },
+        { "uncompressed", QObject::tr("Stores generated tileset images uncompressed.") },
+        { "npcs", QObject::tr("Amount of generated NPCs per map."), QObject::tr("count"), "4" },
+        { "seed", QObject::tr("Seed of the generated content."), QObject::tr("number"), "1095583025" },
+    });
+
+    parser.process(a);
+
+    const QStringList args = parser.positionalArguments();
+    const QString file = (args.isEmpty()) ? parser.value("generate") : args.at(0);
+    if (file.isEmpty())
+        parser.showHelp(1);
+
+    QTextStream &out = AME_CLI_Out();
+    Settings::parse();
+
+
+    // Generates the synthetic ROM first, if requested
+    if (parser.isSet("generate") && !AME_CLI_Generate(parser, parser.value("generate")))
+    {
+        out << ErrorStack::log() << "\n";
+        return 1;
+    }
+
+
+    // Maps the ROM and loads all tables
+    QElapsedTimer timer;
+    timer.start();
+    Tracer::start();
+
+    if (loadAllMapData(file) == -1)
+    {
+        Tracer::stop();
+        out << ErrorStack::log() << "\n";
+        return 1;
+    }
+
+    out << QString("Loaded %1 in %2 ms\n").arg(file).arg(timer.elapsed());
+
+
+    // Performs the requested tasks
+    if (parser.isSet("render"))
+    {
+        const QString folder = parser.value("render");
+        QDir().mkpath(folder);
+
+        timer.restart();
+        const Int32 failed = AME_CLI_RenderMaps(folder);
+        out << QString("Rendered all maps in %1 ms, %2 failed\n").arg(timer.elapsed()).arg(failed);
+    }
+
+    if (parser.isSet("stats"))
+        AME_CLI_PrintStats();
+
+    if (parser.isSet("freespace"))
+        AME_CLI_PrintFreespace();
+
+    Tracer::stop();
+    out << "\n" << Tracer::summary() << "\n";
+
+    if (parser.isSet("trace") && !Tracer::write(parser.value("trace")))
+        out << QString("Could not write %1\n").arg(parser.value("trace"));
+
+    if (parser.isSet("lz77"))
+        AME_CLI_BenchmarkLz77(qMax(1, parser.value("rounds").toInt()));
+
+    if (parser.isSet("tiles"))
+        AME_CLI_BenchmarkTiles(qMax(1, parser.value("tile-rounds").toInt()));
+
+    if (parser.isSet("fill"))
+        AME_CLI_BenchmarkFill(qMax(1, parser.value("fill-rounds").toInt()));
+
+    if (parser.isSet("replace") && !AME_CLI_Replace(parser))
+    {
+        clearAllMapData();
+        return 1;
+    }
+
+
+    clearAllMapData();
+    return 0;
+}
@@ -43,39 +43,41 @@ namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     ConnectionTable::ConnectionTable()
         : IUndoable(),
           m_Offset(0),
           m_Count(0),
-          m_PtrData(0)
+          m_PtrData(0),
+          m_IsModified(false)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     ConnectionTable::ConnectionTable(const ConnectionTable &rvalue)
         : IUndoable(),
           m_Offset(rvalue.m_Offset),
           m_Count(rvalue.m_Count),
-          m_PtrData(rvalue.m_PtrData)
+          m_PtrData(rvalue.m_PtrData),
+          m_IsModified(rvalue.m_IsModified)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     ConnectionTable &ConnectionTable::operator=(const ConnectionTable &rvalue)
@@ -84,6 +86,7 @@ namespace ame
         m_Count = rvalue.m_Count;
         m_PtrData = rvalue.m_PtrData;
         m_Connections = rvalue.m_Connections;
+        m_IsModified = rvalue.m_IsModified;
         return *this;
     }
 
@@ -114,7 +117,7 @@ namespace ame
     // Date of edit:   6/5/2016
     //
     ///////////////////////////////////////////////////////////
-    bool ConnectionTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool ConnectionTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(COT_ERROR_OFFSET, rom.redirected());
@@ -167,7 +170,7 @@ namespace ame
     // Date of edit:   6/5/2016
     //
     ///////////////////////////////////////////////////////////
-    bool ConnectionTable::requiresRepoint(const qboy::Rom &rom)
+    bool ConnectionTable::requiresRepoint(const RomCursor &rom)
     {
         if (m_Connections.size() < m_Count)
             return false;
@@ -194,16 +197,110 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Only the connection data is repointed; the head table
+    // <count><ptr> always stays at the same offset.
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> ConnectionTable::write(UInt32 offset)
+    QList<WriteEntry> ConnectionTable::write(UInt32 offset) const
     {
-        // Placeholder
-        Q_UNUSED(offset);
-        return QList<WriteEntry>();
+        QList<WriteEntry> entries;
+        const UInt32 ptrData = (offset > 0) ? offset : m_PtrData;
+
+
+        // If offset is a repointed offset, clear old data with 0xFF
+        if (offset > 0)
+        {
+            if (m_Count > 0)
+            {
+                WriteEntry clearEntry { m_PtrData };
+                clearEntry.data.fill((char)0xFF, m_Count * 12);
+                entries.push_back(clearEntry);
+            }
+        }
+
+        // If table is smaller than before, clear unused space
+        else if (m_Connections.size() < m_Count)
+        {
+            WriteEntry clearEntry { m_PtrData + m_Connections.size() * 12 };
+            clearEntry.data.fill((char)0xFF, (m_Count - m_Connections.size()) * 12);
+            entries.push_back(clearEntry);
+        }
+
+
+        // Writes all connections, twelve bytes each
+        WriteEntry dataEntry { ptrData };
+        foreach (Connection *entry, m_Connections)
+        {
+            dataEntry.addWord(entry->direction);
+            dataEntry.addWord(entry->offset);
+            dataEntry.data.push_back((char)entry->bank);
+            dataEntry.data.push_back((char)entry->map);
+            dataEntry.addHWord(0x0000); // padding
+        }
+
+        // Writes the head table
+        WriteEntry headEntry { m_Offset };
+        headEntry.addWord(m_Connections.size());
+        headEntry.addPointer(ptrData);
+
+        entries.push_back(dataEntry);
+        entries.push_back(headEntry);
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void ConnectionTable::commit(UInt32 offset)
+    {
+        if (offset > 0)
+        {
+            // Adds an undo entry for the repoint
+            UndoEntry repEntry;
+            repEntry.entry = NULL;
+            repEntry.action = URA_ACTION_REPOINT;
+            repEntry.offset = m_PtrData;
+            s_UndoStack.push_back(repEntry);
+
+            // Sets the repointed offset as new offset
+            m_PtrData = offset;
+        }
+
+        // The written table is the new initial table
+        m_Count = m_Connections.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool ConnectionTable::isModified() const
+    {
+        return m_IsModified;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void ConnectionTable::setModified(bool modified)
+    {
+        m_IsModified = modified;
     }
 
 
@@ -222,9 +319,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ConnectionTable::setConnection(Int32 index, Connection *entry)
@@ -238,13 +335,15 @@ namespace ame
 
         // Modifies the connection
         m_Connections[index] = entry;
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ConnectionTable::addConnection(Connection *entry)
@@ -258,13 +357,15 @@ namespace ame
 
         // Now adds the actual connection
         m_Connections.push_back(entry);
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ConnectionTable::removeConnection(Int32 index)
@@ -278,14 +379,16 @@ namespace ame
 
         // Now removes the connection
         m_Connections.removeAt(index);
+
+        m_IsModified = true;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ConnectionTable::undo()
@@ -308,6 +411,14 @@ namespace ame
             m_Connections.insert(entry.index, entry.entry);
             s_RedoStack.push_back(entry);
         }
+        else if (entry.action == URA_ACTION_REPOINT)
+        {
+            // Swaps the current offset with the previous one
+            UInt32 offset = m_PtrData;
+            m_PtrData = entry.offset;
+            entry.offset = offset;
+            s_RedoStack.push_back(entry);
+        }
         else
         {
             // Modifies the values within that entry
@@ -319,13 +430,15 @@ namespace ame
             // Adds the modified entry to the redo stack
             s_RedoStack.push_back(entry);
         }
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ConnectionTable::redo()
@@ -348,6 +461,14 @@ namespace ame
             m_Connections.removeAt(entry.index);
             s_UndoStack.push_back(entry);
         }
+        else if (entry.action == URA_ACTION_REPOINT)
+        {
+            // Swaps the current offset with the repointed one
+            UInt32 offset = m_PtrData;
+            m_PtrData = entry.offset;
+            entry.offset = offset;
+            s_UndoStack.push_back(entry);
+        }
         else
         {
             // Modifies the values within that entry
@@ -359,5 +480,7 @@ namespace ame
             // Adds the modified entry to the redo stack
             s_UndoStack.push_back(entry);
         }
+
+        m_IsModified = true;
     }
 }
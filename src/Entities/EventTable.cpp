@@ -43,9 +43,9 @@ namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/6/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     EventTable::EventTable()
@@ -58,15 +58,16 @@ namespace ame
           m_PtrNpc(0),
           m_PtrWarp(0),
           m_PtrSign(0),
-          m_PtrTrigger(0)
+          m_PtrTrigger(0),
+          m_IsModified(false)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/6/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     EventTable::EventTable(const EventTable &rvalue)
@@ -83,15 +84,16 @@ namespace ame
           m_Npcs(rvalue.m_Npcs),
           m_Warps(rvalue.m_Warps),
           m_Signs(rvalue.m_Signs),
-          m_Triggers(rvalue.m_Triggers)
+          m_Triggers(rvalue.m_Triggers),
+          m_IsModified(rvalue.m_IsModified)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/6/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     EventTable &EventTable::operator=(const EventTable &rvalue)
@@ -109,6 +111,7 @@ namespace ame
         m_Warps = rvalue.m_Warps;
         m_Signs = rvalue.m_Signs;
         m_Triggers = rvalue.m_Triggers;
+        m_IsModified = rvalue.m_IsModified;
         return *this;
     }
 
@@ -170,7 +173,7 @@ namespace ame
     // Date of edit:   6/6/2016
     //
     ///////////////////////////////////////////////////////////
-    bool EventTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool EventTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(EVT_ERROR_OFFSET, rom.redirected());
@@ -351,7 +354,7 @@ namespace ame
     // Date of edit:   6/7/2016
     //
     ///////////////////////////////////////////////////////////
-    EntityType EventTable::requiresRepoint(const qboy::Rom &rom)
+    EntityType EventTable::requiresRepoint(const RomCursor &rom)
     {
         int toRepoint = ET_Invalid;
 
@@ -412,20 +415,131 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/7/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The head table always stays at the same offset; only the
+    // arrays of the four event types are repointed.
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> EventTable::write(const QList<UInt32> &offsets)
+    QList<WriteEntry> EventTable::write(const QList<UInt32> &offsets) const
     {
-        /*
-         * if (offsets[0] != 0) // repoint NPC table
-         */
+        QList<WriteEntry> entries;
+
+        // Serializes the events of each type into one array
+        QByteArray arrays[4];
+        foreach (Npc *npc, m_Npcs)
+            arrays[0].append(npc->rawData());
+        foreach (Warp *warp, m_Warps)
+            arrays[1].append(warp->rawData());
+        foreach (Trigger *trigger, m_Triggers)
+            arrays[2].append(trigger->rawData());
+        foreach (Sign *sign, m_Signs)
+            arrays[3].append(sign->rawData());
+
+        // Defines the objects for writing the arrays dynamically
+        UInt32 pointers[] { m_PtrNpc, m_PtrWarp, m_PtrTrigger, m_PtrSign };
+        UInt8 counts[] { m_CountNpc, m_CountWarp, m_CountTrigger, m_CountSign };
+        Int32 sizes[] { 24, 8, 16, 12 };
+
+
+        // Writes each event array dynamically
+        for (int i = 0; i < 4; i++)
+        {
+            const Int32 oldSize = counts[i] * sizes[i];
+            const Int32 newSize = arrays[i].size();
+
+            // If offset is a repointed offset, clear old data with 0xFF
+            if (offsets.value(i) > 0)
+            {
+                if (oldSize > 0 && pointers[i] != 0)
+                {
+                    WriteEntry clearEntry { pointers[i] };
+                    clearEntry.data.fill((char)0xFF, oldSize);
+                    entries.push_back(clearEntry);
+                }
+
+                pointers[i] = offsets.value(i);
+            }
+
+            // If array is smaller than before, clear unused space
+            else if (newSize < oldSize)
+            {
+                WriteEntry clearEntry { pointers[i] + newSize };
+                clearEntry.data.fill((char)0xFF, oldSize - newSize);
+                entries.push_back(clearEntry);
+            }
+
+            // A type without events may not have an array at all
+            if (newSize > 0 && pointers[i] != 0)
+            {
+                WriteEntry arrayEntry { pointers[i] };
+                arrayEntry.data = arrays[i];
+                entries.push_back(arrayEntry);
+            }
 
-        // Placeholder
-        Q_UNUSED(offsets);
-        return QList<WriteEntry>();
+            counts[i] = newSize / sizes[i];
+        }
+
+
+        // Writes the head table with the new counts and pointers
+        WriteEntry headEntry { m_Offset };
+        for (int i = 0; i < 4; i++)
+            headEntry.data.push_back((char)counts[i]);
+        for (int i = 0; i < 4; i++)
+            headEntry.addPointer(pointers[i]);
+
+        entries.push_back(headEntry);
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void EventTable::commit(const QList<UInt32> &offsets)
+    {
+        UInt32* pointers[] { &m_PtrNpc, &m_PtrWarp, &m_PtrTrigger, &m_PtrSign };
+        UInt8* counts[] { &m_CountNpc, &m_CountWarp, &m_CountTrigger, &m_CountSign };
+        const Int32 sizes[] { m_Npcs.size(), m_Warps.size(), m_Triggers.size(), m_Signs.size() };
+
+        // The written table is the new initial table
+        for (int i = 0; i < 4; i++)
+        {
+            if (offsets.value(i) > 0)
+                *pointers[i] = offsets.value(i);
+
+            *counts[i] = sizes[i];
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool EventTable::isModified() const
+    {
+        return m_IsModified;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void EventTable::setModified(bool modified)
+    {
+        m_IsModified = modified;
     }
 
 
@@ -480,9 +594,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/7/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void EventTable::setEvent(EntityType type, void *event)
@@ -522,6 +636,8 @@ namespace ame
 
         // Adds the undo entry to the stack
         s_UndoStack.push_back(undo);
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
@@ -43,37 +43,39 @@ namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapScriptTable::MapScriptTable()
         : IUndoable(),
           m_Offset(0),
-          m_Count(0)
+          m_Count(0),
+          m_IsModified(false)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapScriptTable::MapScriptTable(const MapScriptTable &rvalue)
         : IUndoable(),
           m_Offset(rvalue.m_Offset),
-          m_Count(rvalue.m_Count)
+          m_Count(rvalue.m_Count),
+          m_IsModified(rvalue.m_IsModified)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapScriptTable &MapScriptTable::operator=(const MapScriptTable &rvalue)
@@ -81,6 +83,7 @@ namespace ame
         m_Offset = rvalue.m_Offset;
         m_Count = rvalue.m_Count;
         m_Scripts = rvalue.m_Scripts;
+        m_IsModified = rvalue.m_IsModified;
         return *this;
     }
 
@@ -115,7 +118,7 @@ namespace ame
     // it when throwing an error via AME_THROW.
     //
     ///////////////////////////////////////////////////////////
-    bool MapScriptTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool MapScriptTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(MST_ERROR_OFFSET, rom.redirected());
@@ -197,7 +200,7 @@ namespace ame
     // Date of edit:   6/4/2016
     //
     ///////////////////////////////////////////////////////////
-    bool MapScriptTable::requiresRepoint(const qboy::Rom &rom)
+    bool MapScriptTable::requiresRepoint(const RomCursor &rom)
     {
         if (m_Scripts.size() < m_Count)
             return false;
@@ -220,16 +223,120 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every entry is sized five bytes; the table is terminated
+    // by a single zero byte. The auto-script structures of the
+    // handler types are written in place.
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> MapScriptTable::write(UInt32 offset)
+    QList<WriteEntry> MapScriptTable::write(UInt32 offset) const
     {
-        // Placeholder
-        Q_UNUSED(offset);
-        return QList<WriteEntry>();
+        QList<WriteEntry> entries;
+        const Int32 oldSize = (m_Count > 0) ? (m_Count - 1) * 5 + 1 : 0;
+        const Int32 newSize = m_Scripts.size() * 5 + 1;
+
+
+        // If offset is a repointed offset, clear old data with 0xFF
+        if (offset > 0)
+        {
+            if (oldSize > 0)
+            {
+                WriteEntry clearEntry { m_Offset };
+                clearEntry.data.fill((char)0xFF, oldSize);
+                entries.push_back(clearEntry);
+            }
+        }
+
+        // If table is smaller than before, clear unused space
+        else if (newSize < oldSize)
+        {
+            WriteEntry clearEntry { m_Offset + newSize };
+            clearEntry.data.fill((char)0xFF, oldSize - newSize);
+            entries.push_back(clearEntry);
+        }
+
+
+        // Writes the type and pointer of every script
+        WriteEntry tableEntry { (offset > 0) ? offset : m_Offset };
+        foreach (MapScript *script, m_Scripts)
+        {
+            tableEntry.data.push_back((char)script->type);
+            tableEntry.addPointer(script->ptrVoid);
+
+            if (script->type != MST_HandlerEB0 && script->type != MST_HandlerF28)
+                continue;
+
+            // Writes the auto-run scripts and their terminator
+            WriteEntry autoEntry { script->ptrVoid };
+            foreach (const AutoScript &autoScript, script->data)
+            {
+                autoEntry.addHWord(autoScript.variable);
+                autoEntry.addHWord(autoScript.value);
+                autoEntry.addPointer(autoScript.ptrScript);
+            }
+
+            autoEntry.addHWord(0x0000);
+            entries.push_back(autoEntry);
+        }
+
+        // Appends the ending sequence to the table
+        tableEntry.data.push_back((char)0x00);
+        entries.push_back(tableEntry);
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapScriptTable::commit(UInt32 offset)
+    {
+        if (offset > 0)
+        {
+            // Adds an undo entry for the repoint
+            UndoEntry repEntry;
+            repEntry.script = NULL;
+            repEntry.action = URA_ACTION_REPOINT;
+            repEntry.offset = m_Offset;
+            s_UndoStack.push_back(repEntry);
+
+            // Sets the repointed offset as new offset
+            m_Offset = offset;
+        }
+
+        // The written table is the new initial table
+        m_Count = m_Scripts.size() + 1;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapScriptTable::isModified() const
+    {
+        return m_IsModified;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapScriptTable::setModified(bool modified)
+    {
+        m_IsModified = modified;
     }
 
 
@@ -248,9 +355,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MapScriptTable::setScript(Int32 index, MapScript *script)
@@ -264,13 +371,15 @@ namespace ame
 
         // Modifies the script
         m_Scripts[index] = script;
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MapScriptTable::addScript(MapScript *script)
@@ -284,13 +393,15 @@ namespace ame
 
         // Now adds the actual script
         m_Scripts.push_back(script);
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MapScriptTable::removeScript(Int32 index)
@@ -304,14 +415,16 @@ namespace ame
 
         // Now removes the script
         m_Scripts.removeAt(index);
+
+        m_IsModified = true;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MapScriptTable::undo()
@@ -334,6 +447,14 @@ namespace ame
             m_Scripts.insert(entry.index, entry.script);
             s_RedoStack.push_back(entry);
         }
+        else if (entry.action == URA_ACTION_REPOINT)
+        {
+            // Swaps the current offset with the previous one
+            UInt32 offset = m_Offset;
+            m_Offset = entry.offset;
+            entry.offset = offset;
+            s_RedoStack.push_back(entry);
+        }
         else
         {
             // Modifies the values within that entry
@@ -345,13 +466,15 @@ namespace ame
             // Adds the modified entry to the redo stack
             s_RedoStack.push_back(entry);
         }
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MapScriptTable::redo()
@@ -374,6 +497,14 @@ namespace ame
             m_Scripts.removeAt(entry.index);
             s_UndoStack.push_back(entry);
         }
+        else if (entry.action == URA_ACTION_REPOINT)
+        {
+            // Swaps the current offset with the repointed one
+            UInt32 offset = m_Offset;
+            m_Offset = entry.offset;
+            entry.offset = offset;
+            s_UndoStack.push_back(entry);
+        }
         else
         {
             // Modifies the values within that entry
@@ -385,5 +516,7 @@ namespace ame
             // Adds the modified entry to the redo stack
             s_UndoStack.push_back(entry);
         }
+
+        m_IsModified = true;
     }
 }
@@ -261,27 +261,26 @@ namespace ame
     bool MainWindow::loadROM(const QString &file)
     {
         // Close a previous ROM and destroy objects
-        if (m_Rom.info().isLoaded())
+        if (!m_RomPath.isEmpty())
         {
-            // Clears the ROM data
-            m_Rom.clearCache();
-            m_Rom.close();
+            m_RomPath.clear();
 
             // Clears old data and UI
             clearAllMapData();
             clearBeforeLoading();
         }
 
-        // Attempts to open the new ROM file
-        if (!m_Rom.loadFromFile(file))
+        // The ROM is mapped when loading the map data; it is
+        // only checked for existence here
+        QFileInfo info(file);
+        if (!info.isFile() || !info.isReadable())
         {
-            m_Rom.clearCache();
-            m_Rom.close();
-
-            Messages::showError(this, m_Rom.lastError());
+            Messages::showError(this, tr("The ROM file %1 could not be opened.").arg(QDir::toNativeSeparators(file)));
             return false;
         }
 
+        m_RomPath = file;
+
         // Add ROM file to recent files list
         QList<QString> recentFiles = SETTINGS(RecentFiles);
 
@@ -333,7 +332,7 @@ namespace ame
     {
         /* TODO: Design form to show error messages */
 
-        int result = loadAllMapData(m_Rom);
+        int result = loadAllMapData(m_RomPath);
         if (result < 0)
         {
             ErrorWindow errorWindow(this);
@@ -342,19 +341,18 @@ namespace ame
         }
 
         //setWindowTitle(QString("Awesome Map Editor | %1").arg(m_Rom.info().name()));
-		setWindowFilePath(m_Rom.info().path());
-        m_statusLabel.setText(tr("ROM %1 loaded in %2 ms.").arg(m_Rom.info().name(), QString::number(result)));
+		setWindowFilePath(m_RomPath);
+        m_statusLabel.setText(tr("ROM %1 loaded in %2 ms.").arg(dat_RomData->name(), QString::number(result)));
 
         setupAfterLoading();
-        m_Rom.clearCache();
         ui->glEntityEditor->setOverworlds(&dat_OverworldTable->argbImages());
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Event
-    // Contributors:   Pokedude, Diegoisawesome, Nekaida
-    // Last edit by:   Nekaida
-    // Date of edit:   3/30/2017
+    // Contributors:   Pokedude, Diegoisawesome, Nekaida, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MainWindow::setupAfterLoading()
@@ -619,7 +617,7 @@ namespace ame
                     layoutItem->setText('[' +
                                       QString("%1").arg(i, 4 , 16, QChar('0')).toUpper() +
                                       "] ");
-                    layoutItem->setData(dat_MapLayoutTable->mapHeaders().at(i - 1)->offset(), Qt::UserRole);
+                    layoutItem->setData(dat_MapLayoutTable->layoutOffset(i - 1), Qt::UserRole);
                     root->appendRow(layoutItem);
                 }
                 int bankCount = dat_MapBankTable->banks().size();
@@ -669,12 +667,14 @@ namespace ame
                     for (int j = 0; j < mapCount; j++)
                     {
                         Map *map = bank->maps()[j];
+                        const UInt32 ptrPrimary = dat_MapLayoutTable->primaryOffset(map->layoutIndex() - 1);
+                        const UInt32 ptrSecondary = dat_MapLayoutTable->secondaryOffset(map->layoutIndex() - 1);
                         QModelIndexList primaryList;
                         if (root->rowCount() > 0)
-                            primaryList = root->model()->match(root->child(0)->index(), Qt::UserRole, map->header().ptrPrimary());
+                            primaryList = root->model()->match(root->child(0)->index(), Qt::UserRole, ptrPrimary);
                         QModelIndexList secondaryList;
                         if (root->rowCount() > 0)
-                            secondaryList = root->model()->match(root->child(0)->index(), Qt::UserRole, map->header().ptrSecondary());
+                            secondaryList = root->model()->match(root->child(0)->index(), Qt::UserRole, ptrSecondary);
 
                         QStandardItem *primaryItem;
                         QStandardItem *secondaryItem;
@@ -684,9 +684,9 @@ namespace ame
                             primaryItem = new QStandardItem();
                             primaryItem->setEditable(false);
                             primaryItem->setText('[' +
-                                              QString("%1").arg(map->header().ptrPrimary(), 8 , 16, QChar('0')).toUpper() +
+                                              QString("%1").arg(ptrPrimary, 8 , 16, QChar('0')).toUpper() +
                                               "] ");
-                            primaryItem->setData(map->header().ptrPrimary(), Qt::UserRole);
+                            primaryItem->setData(ptrPrimary, Qt::UserRole);
                             root->appendRow(primaryItem);
                         }
                         else
@@ -697,9 +697,9 @@ namespace ame
                             secondaryItem = new QStandardItem();
                             secondaryItem->setEditable(false);
                             secondaryItem->setText('[' +
-                                              QString("%1").arg(map->header().ptrSecondary(), 8 , 16, QChar('0')).toUpper() +
+                                              QString("%1").arg(ptrSecondary, 8 , 16, QChar('0')).toUpper() +
                                               "] ");
-                            secondaryItem->setData(map->header().ptrSecondary(), Qt::UserRole);
+                            secondaryItem->setData(ptrSecondary, Qt::UserRole);
                             root->appendRow(secondaryItem);
                         }
                         else
@@ -934,6 +934,30 @@ namespace ame
             loadMapData();
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Slot
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MainWindow::on_action_Save_ROM_triggered()
+    {
+        if (m_RomPath.isEmpty())
+            return;
+
+        QTime stopWatch;
+        stopWatch.start();
+        if (!saveAllMapData())
+        {
+            ErrorWindow errorWindow(this);
+            errorWindow.exec();
+            return;
+        }
+
+        m_statusLabel.setText(tr("ROM saved in %1 ms.").arg(QString::number(stopWatch.elapsed())));
+    }
+
     ///////////////////////////////////////////////////////////
     // Function type:  Slot
     // Contributors:   Pokedude
@@ -985,9 +1009,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Slot
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Pokedude
-    // Date of edit:   7/5/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MainWindow::on_treeView_activated(const QModelIndex &index)
@@ -1015,10 +1039,10 @@ namespace ame
                     return;
                 }
 
-                MapHeader header;
-                header.read(m_Rom, offset);
-                if (header.primary()->image()->raw().isEmpty() ||
-                    header.primary()->image()->raw().isEmpty())
+                MapHeader *header = LayoutManager::load(RomCursor(*dat_RomData), offset);
+                if (header == NULL ||
+                    header->primary()->pixels().isEmpty() ||
+                    header->secondary()->pixels().isEmpty())
                 {
                     // Tilesets invalid, abort
                     Messages::showMessage(this, "Layout says: \"I don't want to load tilesets!\"");
@@ -1026,7 +1050,7 @@ namespace ame
                 }
 
 
-                ui->glMapEditor->setLayout(header);
+                ui->glMapEditor->setLayout(*header);
                 ui->glMapEditor->update();
                 ui->glBlockEditor->setMapView(ui->glMapEditor);
                 ui->glBlockEditor->update();
@@ -1137,9 +1161,42 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Helper
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   12/7/2016
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MainWindow::loadMapTables(Map *map)
+    {
+        RomCursor rom(*dat_RomData);
+        if (!map->load(rom))
+            return false;
+
+        QList<Tileset *> tilesets;
+        tilesets << map->header().primary() << map->header().secondary();
+        foreach (Connection *connex, map->connections().connections())
+        {
+            if (connex->bank >= dat_MapBankTable->banks().size() ||
+                connex->map >= dat_MapBankTable->banks().at(connex->bank)->maps().size())
+                continue;
+
+            Map *connected = dat_MapBankTable->banks().at(connex->bank)->maps().at(connex->map);
+            if (!connected->load(rom))
+                return false;
+
+            tilesets << connected->header().primary() << connected->header().secondary();
+        }
+
+        // Decodes the tilesets of all those maps in parallel
+        TilesetManager::warmUp(tilesets);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     bool MainWindow::loadMap(Map *currentMap, const QString &name)
@@ -1148,8 +1205,16 @@ namespace ame
         QTime stopWatch;
         stopWatch.start();
 
+        // Maps are parsed on demand; connected maps are drawn too
+        if (!loadMapTables(currentMap))
+        {
+            ErrorWindow errorWindow(this);
+            errorWindow.exec();
+            return false;
+        }
+
         // Fills all the OpenGL widgets
-        ui->glMapEditor->setMap(m_Rom, currentMap);
+        ui->glMapEditor->setMap(currentMap);
         ui->glMapEditor->update();
         ui->glBlockEditor->setMapView(ui->glMapEditor);
         ui->glBlockEditor->update();
@@ -1248,7 +1313,7 @@ namespace ame
         }
         CHANGESETTING(MapSortOrder, static_cast<MapSortOrderType>(index));
         Settings::write();
-        if(m_Rom.info().isLoaded())
+        if(!m_RomPath.isEmpty())
             updateTreeView();
     }
 
@@ -1294,7 +1359,7 @@ namespace ame
     {
         CHANGESETTING(ShowSprites, checked);
         Settings::write();
-        if(m_Rom.info().isLoaded() && ui->tabWidget->currentIndex() == 1)
+        if(!m_RomPath.isEmpty() && ui->tabWidget->currentIndex() == 1)
             ui->glEntityEditor->repaint();
     }
 
@@ -1860,9 +1925,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Event
-    // Contributors:   Nekaida
-    // Last edit by:   Nekaida
-    // Date of edit:   3/29/2017
+    // Contributors:   Nekaida, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void MainWindow::checkWarp()
@@ -1872,6 +1937,7 @@ namespace ame
     int tempNum = ui->warp_number->value();
     if (tempBank < dat_MapBankTable->banks().size() &&
         tempMap < dat_MapBankTable->banks().at(tempBank)->maps().size() &&
+        dat_MapBankTable->banks()[tempBank]->maps()[tempMap]->load(RomCursor(*dat_RomData)) &&
         tempNum < dat_MapBankTable->banks()[tempBank]->maps()[tempMap]->entities().warps().size())
         ui->btnWarpToDest->setEnabled(true);
     else
@@ -2088,7 +2154,7 @@ namespace ame
             return false;
         }
         QStringList args;
-        args << QDir::toNativeSeparators(m_Rom.info().path()) << QString::number(scriptAddr, 16);
+        args << QDir::toNativeSeparators(m_RomPath) << QString::number(scriptAddr, 16);
         return QProcess::startDetached(SETTINGS(ScriptEditor), args);
     }
 
@@ -0,0 +1,255 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Graphics/BlocksetCache.hpp>
+#include <AME/Graphics/MapRenderer.hpp>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Static variable definition
+    //
+    ///////////////////////////////////////////////////////////
+    QHash<quint64, Blockset> BlocksetCache::m_Blocksets;
+    QList<quint64> BlocksetCache::m_Recent;
+    UInt32 BlocksetCache::m_Capacity = 32 * 1024 * 1024;
+    UInt32 BlocksetCache::m_Resident = 0;
+    Int32 BlocksetCache::m_Hits = 0;
+    Int32 BlocksetCache::m_Misses = 0;
+    QMutex BlocksetCache::m_Mutex;
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_BC_Size(const Blockset &blockset)
+    {
+        return blockset.background.size() + blockset.foreground.size() + blockset.palette.size() * sizeof(QRgb);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // If two threads miss the same pair at once, both compose
+    // it, but only the first result is kept.
+    //
+    ///////////////////////////////////////////////////////////
+    Blockset BlocksetCache::get(const Tileset *primary, const Tileset *secondary)
+    {
+        const quint64 key = (static_cast<quint64>(primary->offset()) << 32) | secondary->offset();
+        {
+            QMutexLocker lock(&m_Mutex);
+            QHash<quint64, Blockset>::const_iterator it = m_Blocksets.constFind(key);
+            if (it != m_Blocksets.constEnd())
+            {
+                m_Hits++;
+                m_Recent.removeOne(key);
+                m_Recent.push_back(key);
+                return it.value();
+            }
+
+            m_Misses++;
+        }
+
+
+        // Composes both tilesets into one buffer per layer
+        const Int32 countPrimary = MapRenderer::primaryBlockCount();
+        const Int32 countSecondary = MapRenderer::secondaryBlockCount();
+        const Int32 primarySize = 128 * (countPrimary / 8 * 16);
+
+        Blockset blockset;
+        blockset.background.fill('\0', primarySize + 128 * (countSecondary / 8 * 16));
+        blockset.foreground.fill('\0', blockset.background.size());
+        blockset.palette = MapRenderer::palette(primary, secondary);
+
+        UInt8 *bgPixels = reinterpret_cast<UInt8 *>(blockset.background.data());
+        UInt8 *fgPixels = reinterpret_cast<UInt8 *>(blockset.foreground.data());
+        MapRenderer::drawBlockset(primary, primary, secondary, countPrimary, bgPixels, fgPixels);
+        MapRenderer::drawBlockset(secondary, primary, secondary, countSecondary,
+                                  bgPixels + primarySize, fgPixels + primarySize);
+
+
+        // Inserts the blockset and evicts the least recent ones
+        QMutexLocker lock(&m_Mutex);
+        QHash<quint64, Blockset>::const_iterator it = m_Blocksets.constFind(key);
+        if (it != m_Blocksets.constEnd())
+            return it.value();
+
+        m_Blocksets.insert(key, blockset);
+        m_Recent.push_back(key);
+        m_Resident += AME_BC_Size(blockset);
+        evict();
+
+        return blockset;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlocksetCache::invalidate(UInt32 offset)
+    {
+        QMutexLocker lock(&m_Mutex);
+        QMutableListIterator<quint64> it(m_Recent);
+        while (it.hasNext())
+        {
+            const quint64 key = it.next();
+            if (static_cast<UInt32>(key >> 32) == offset || static_cast<UInt32>(key) == offset)
+            {
+                m_Resident -= AME_BC_Size(m_Blocksets.take(key));
+                it.remove();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlocksetCache::clear()
+    {
+        QMutexLocker lock(&m_Mutex);
+        m_Blocksets.clear();
+        m_Recent.clear();
+        m_Resident = 0;
+        m_Hits = 0;
+        m_Misses = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlocksetCache::setCapacity(UInt32 bytes)
+    {
+        QMutexLocker lock(&m_Mutex);
+        m_Capacity = bytes;
+        evict();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlocksetCache::evict()
+    {
+        while (m_Resident > m_Capacity && m_Recent.size() > 1)
+        {
+            const quint64 oldest = m_Recent.takeFirst();
+            m_Resident -= AME_BC_Size(m_Blocksets.take(oldest));
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 BlocksetCache::capacity()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Capacity;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 BlocksetCache::residentBytes()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Resident;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 BlocksetCache::hits()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Hits;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 BlocksetCache::misses()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Misses;
+    }
+}
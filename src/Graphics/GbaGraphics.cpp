@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Graphics/GbaGraphics.hpp>
+#include <QtEndian>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Each 5-bit channel is scaled to eight bits by a shift,
+    // exactly like QBoy did, so that rendered maps stay equal.
+    //
+    ///////////////////////////////////////////////////////////
+    bool GbaGraphics::readPalette(const RomData &rom, UInt32 offset, QVector<QRgb> &dest, Int32 count)
+    {
+        if (count < 0 || !rom.canRead(offset, count * 2))
+            return false;
+
+        const UInt8 *src = rom.data() + offset;
+        dest.resize(count);
+        for (Int32 i = 0; i < count; i++)
+        {
+            const UInt16 color = qFromLittleEndian<quint16>(src + i * 2);
+            dest[i] = qRgb((color & 0x1F) << 3, ((color >> 5) & 0x1F) << 3, ((color >> 10) & 0x1F) << 3);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void GbaGraphics::decodeTiles(const UInt8 *tiles, Int32 tileCount, Int32 width, QByteArray &dest)
+    {
+        const Int32 columns = width / 8;
+        const Int32 height = (tileCount + columns - 1) / columns * 8;
+
+        dest.fill(0, width * height);
+        UInt8 *pixels = reinterpret_cast<UInt8 *>(dest.data());
+        for (Int32 i = 0; i < tileCount; i++)
+        {
+            UInt8 *row = pixels + (i % columns) * 8 + (i / columns) * 8 * width;
+            for (int y = 0; y < 8; y++, row += width)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    UInt8 pair = *tiles++;
+                    row[x * 2] = (pair & 0xF);
+                    row[x * 2 + 1] = (pair >> 4);
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool GbaGraphics::readImage(const RomData &rom, UInt32 offset, Int32 width, Int32 height, QByteArray &dest)
+    {
+        const Int32 tileCount = (width / 8) * (height / 8);
+        if (tileCount <= 0 || !rom.canRead(offset, tileCount * 32))
+            return false;
+
+        decodeTiles(rom.data() + offset, tileCount, width, dest);
+        return true;
+    }
+}
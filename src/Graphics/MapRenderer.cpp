@@ -0,0 +1,420 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Graphics/BlocksetCache.hpp>
+#include <AME/Graphics/MapRenderer.hpp>
+#include <AME/System/Configuration.hpp>
+#include <QElapsedTimer>
+#include <QtEndian>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define AME_MR_SSE2
+#endif
+
+
+///////////////////////////////////////////////////////////
+// Local definitions
+//
+///////////////////////////////////////////////////////////
+#define MR_BYTE_LANES   Q_UINT64_C(0x0101010101010101)
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Per-pixel variant of drawTile, serves as reference for
+    // the benchmark.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_MR_DrawTileReference(const QByteArray &image, const Tile &tile, UInt8 *dest, Int32 stride)
+    {
+        const bool valid = (tile.tile < image.size() / 64);
+        const Int32 tileX = (tile.tile % 16) * 8;
+        const Int32 tileY = (tile.tile / 16) * 8;
+
+        for (int y = 0; y < 8; y++)
+        {
+            for (int x = 0; x < 8; x++)
+            {
+                const Int32 srcX = tileX + (tile.flipX ? 7 - x : x);
+                const Int32 srcY = tileY + (tile.flipY ? 7 - y : y);
+                dest[x + y * stride] = (valid) ? static_cast<UInt8>(image.at(srcX + srcY * 128) + tile.palette * 16) : 0;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 MapRenderer::primaryBlockCount()
+    {
+        return (CONFIG(RomType) == RT_FRLG) ? 0x280 : 0x200;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 MapRenderer::secondaryBlockCount()
+    {
+        return (CONFIG(RomType) == RT_FRLG) ? 0x180 : 0x200;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QVector<QRgb> MapRenderer::palette(const Tileset *primary, const Tileset *secondary)
+    {
+        QVector<QRgb> colors;
+        colors.reserve(256);
+
+        // Retrieves the palettes, combines them, removes bg color
+        foreach (const QVector<QRgb> &pal, primary->palettes())
+        {
+            colors += pal;
+            colors[colors.size() - pal.size()] &= RGB_MASK;
+        }
+        foreach (const QVector<QRgb> &pal, secondary->palettes())
+        {
+            colors += pal;
+            colors[colors.size() - pal.size()] &= RGB_MASK;
+        }
+        while (colors.size() < 256)
+        {
+            colors.push_back(qRgba(0, 0, 0, 0));
+        }
+
+        return colors;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapRenderer::drawTile(const QByteArray &image, const Tile &tile, UInt8 *dest, Int32 stride)
+    {
+        if (tile.tile >= image.size() / 64)
+        {
+            for (int y = 0; y < 8; y++)
+                std::memset(dest + y * stride, 0, 8);
+
+            return;
+        }
+
+        const UInt8 *src = reinterpret_cast<const UInt8 *>(image.constData())
+                         + (tile.tile % 16) * 8 + (tile.tile / 16) * 8 * 128;
+
+        // Vertical flipping only reverses the order of the rows
+        Int32 srcStride = 128;
+        if (tile.flipY)
+        {
+            src += 7 * 128;
+            srcStride = -128;
+        }
+
+    #ifdef AME_MR_SSE2
+        // Two rows per register; the palette offset never carries
+        // into the next pixel, because pixels are below 16
+        const __m128i palette = _mm_set1_epi8(static_cast<char>(tile.palette * 16));
+        for (int y = 0; y < 8; y += 2)
+        {
+            __m128i rows = _mm_unpacklo_epi64(
+                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + y * srcStride)),
+                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + (y + 1) * srcStride)));
+
+            if (tile.flipX)
+            {
+                // Reverses the words of each row, then the bytes of each word
+                rows = _mm_shufflelo_epi16(rows, _MM_SHUFFLE(0, 1, 2, 3));
+                rows = _mm_shufflehi_epi16(rows, _MM_SHUFFLE(0, 1, 2, 3));
+                rows = _mm_or_si128(_mm_slli_epi16(rows, 8), _mm_srli_epi16(rows, 8));
+            }
+
+            rows = _mm_add_epi8(rows, palette);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dest + y * stride), rows);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dest + (y + 1) * stride), _mm_unpackhi_epi64(rows, rows));
+        }
+    #else
+        // One row per 64-bit word; reversing the bytes of the word
+        // reverses the pixels regardless of the host byte order
+        const quint64 palette = static_cast<quint64>(tile.palette * 16) * MR_BYTE_LANES;
+        for (int y = 0; y < 8; y++)
+        {
+            quint64 row;
+            std::memcpy(&row, src + y * srcStride, 8);
+            if (tile.flipX)
+                row = qbswap(row);
+
+            row += palette;
+            std::memcpy(dest + y * stride, &row, 8);
+        }
+    #endif
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapRenderer::drawBlockset(const Tileset *tileset, const Tileset *primary, const Tileset *secondary,
+                                   Int32 capacity, UInt8 *background, UInt8 *foreground)
+    {
+        const Int32 countPrimary = primaryBlockCount();
+        const QByteArray &priRaw = primary->pixels();
+        const QByteArray &secRaw = secondary->pixels();
+        const Int32 blockCount = qMin(tileset->blockCount(), capacity);
+
+        for (int j = 0; j < blockCount; j++)
+        {
+            Block curBlock = tileset->block(j);
+            Int32 blockX = (j % 8) * 16;
+            Int32 blockY = (j / 8) * 16;
+
+            // The first four tiles form the background, the
+            // remaining four the foreground
+            for (int k = 0; k < 8; k++)
+            {
+                Tile tile = curBlock.tiles[k];
+                UInt8 *layer = (k < 4) ? background : foreground;
+                Int32 subX = (((k % 4) % 2) * 8) + blockX;
+                Int32 subY = (((k % 4) / 2) * 8) + blockY;
+                UInt8 *dest = layer + subX + subY * 128;
+
+                if (tile.tile >= countPrimary)
+                {
+                    tile.tile -= countPrimary;
+                    drawTile(secRaw, tile, dest, 128);
+                }
+                else
+                {
+                    drawTile(priRaw, tile, dest, 128);
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapRenderer::drawBlock(const UInt8 *blockset, Int32 block, UInt8 *dest, Int32 stride)
+    {
+        const UInt8 *src = blockset + (block % 8) * 16 + (block / 8) * 16 * 128;
+        for (int y = 0; y < 16; y++)
+            std::memcpy(dest + y * stride, src + y * 128, 16);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The blockset comes from the cache; its secondary blocks
+    // follow the primary ones, so that a block number can be
+    // used as index without distinguishing the tilesets.
+    //
+    ///////////////////////////////////////////////////////////
+    QImage MapRenderer::render(const MapHeader &header)
+    {
+        const Tileset *primary = header.primary();
+        const Tileset *secondary = header.secondary();
+        if (primary == NULL || secondary == NULL)
+            return QImage();
+
+        const Int32 countTotal = primaryBlockCount() + secondaryBlockCount();
+        const Blockset blockset = BlocksetCache::get(primary, secondary);
+        const UInt8 *bgPixels = reinterpret_cast<const UInt8 *>(blockset.background.constData());
+        const UInt8 *fgPixels = reinterpret_cast<const UInt8 *>(blockset.foreground.constData());
+
+        // The background color is only opaque on the bottom layer
+        const QVector<QRgb> &fgColors = blockset.palette;
+        QVector<QRgb> bgColors = fgColors;
+        bgColors[0] = qRgba(qRed(bgColors[0]), qGreen(bgColors[0]), qBlue(bgColors[0]), 255);
+
+        const MapBlockGrid &grid = header.blocks();
+        QImage image(grid.width() * 16, grid.height() * 16, QImage::Format_ARGB32);
+        image.fill(0);
+
+        UInt8 backBlock[256];
+        UInt8 foreBlock[256];
+        for (int i = 0; i < grid.size(); i++)
+        {
+            const Int32 block = grid.data()[i] & MBG_BLOCK_MASK;
+            if (block >= countTotal)
+                continue;
+
+            drawBlock(bgPixels, block, backBlock, 16);
+            drawBlock(fgPixels, block, foreBlock, 16);
+
+            // Draws the foreground over the background
+            const Int32 mapX = (i % grid.width()) * 16;
+            const Int32 mapY = (i / grid.width()) * 16;
+            for (int y = 0; y < 16; y++)
+            {
+                QRgb *row = reinterpret_cast<QRgb *>(image.scanLine(mapY + y)) + mapX;
+                for (int x = 0; x < 16; x++)
+                {
+                    const QRgb top = fgColors[foreBlock[x + y * 16]];
+                    row[x] = (qAlpha(top) != 0) ? top : bgColors[backBlock[x + y * 16]];
+                }
+            }
+        }
+
+        return image;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Both variants draw the same tiles to separate blocksets
+    // which are compared afterwards.
+    //
+    ///////////////////////////////////////////////////////////
+    TileBenchmark MapRenderer::benchmark(const Tileset *primary, const Tileset *secondary, Int32 rounds)
+    {
+        TileBenchmark result;
+        result.tiles = 0;
+        result.referenceSpeed = 0.0;
+        result.kernelSpeed = 0.0;
+        result.identical = true;
+
+        const Int32 countPrimary = primaryBlockCount();
+        const Int32 countTotal = countPrimary + secondaryBlockCount();
+        const QByteArray &priRaw = primary->pixels();
+        const QByteArray &secRaw = secondary->pixels();
+
+        // Gathers the tiles of both tilesets, with their destination
+        QVector<Tile> tiles;
+        QVector<const QByteArray *> images;
+        QVector<Int32> targets;
+        for (int i = 0; i < 2; i++)
+        {
+            const Tileset *tileset = (i == 0) ? primary : secondary;
+            const Int32 first = (i == 0) ? 0 : countPrimary;
+            const Int32 count = qMin(tileset->blockCount(), (i == 0) ? countPrimary : countTotal - countPrimary);
+
+            for (int j = 0; j < count; j++)
+            {
+                const Block curBlock = tileset->block(j);
+                const Int32 block = first + j;
+
+                for (int k = 0; k < 8; k++)
+                {
+                    Tile tile = curBlock.tiles[k];
+                    if (tile.tile >= countPrimary)
+                    {
+                        tile.tile -= countPrimary;
+                        images.push_back(&secRaw);
+                    }
+                    else
+                    {
+                        images.push_back(&priRaw);
+                    }
+
+                    const Int32 subX = ((k % 2) * 8) + (block % 8) * 16;
+                    const Int32 subY = (((k % 4) / 2) * 8) + (block / 8) * 16 + ((k < 4) ? 0 : countTotal * 2);
+                    tiles.push_back(tile);
+                    targets.push_back(subX + subY * 128);
+                }
+            }
+        }
+
+        // Background and foreground are stacked in one buffer
+        QByteArray reference(countTotal * 4 * 128, '\0');
+        QByteArray kernel(reference.size(), '\0');
+        UInt8 *refPixels = reinterpret_cast<UInt8 *>(reference.data());
+        UInt8 *kerPixels = reinterpret_cast<UInt8 *>(kernel.data());
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int r = 0; r < rounds; r++)
+            for (int i = 0; i < tiles.size(); i++)
+                AME_MR_DrawTileReference(*images.at(i), tiles.at(i), refPixels + targets.at(i), 128);
+        const qint64 referenceTime = timer.nsecsElapsed();
+
+        timer.start();
+        for (int r = 0; r < rounds; r++)
+            for (int i = 0; i < tiles.size(); i++)
+                drawTile(*images.at(i), tiles.at(i), kerPixels + targets.at(i), 128);
+        const qint64 kernelTime = timer.nsecsElapsed();
+
+        result.tiles = tiles.size();
+        result.identical = (reference == kernel);
+
+        // Converts tiles per nanosecond to million tiles per second
+        const double total = (double)result.tiles * rounds * 1000.0;
+        if (referenceTime > 0)
+            result.referenceSpeed = total / referenceTime;
+        if (kernelTime > 0)
+            result.kernelSpeed = total / kernelTime;
+
+        return result;
+    }
+}
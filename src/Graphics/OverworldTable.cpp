@@ -37,7 +37,11 @@
 ///////////////////////////////////////////////////////////
 #include <AME/Graphics/GraphicsErrors.hpp>
 #include <AME/Graphics/OverworldTable.hpp>
+#include <AME/Graphics/GbaGraphics.hpp>
 #include <AME/System/Configuration.hpp>
+#include <AME/System/Tracer.hpp>
+#include <QMap>
+#include <cstring>
 
 
 namespace ame
@@ -55,63 +59,56 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     OverworldTable::OverworldTable(const OverworldTable &rvalue)
-        : m_Images(rvalue.m_Images)
+        : m_Palettes(rvalue.m_Palettes),
+          m_Images(rvalue.m_Images),
+          m_Argb(rvalue.m_Argb)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     OverworldTable &OverworldTable::operator=(const OverworldTable &rvalue)
     {
+        m_Palettes = rvalue.m_Palettes;
         m_Images = rvalue.m_Images;
+        m_Argb = rvalue.m_Argb;
         return *this;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Destructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     OverworldTable::~OverworldTable()
     {
-        m_Palettes = m_Palettes.toSet().toList();
-        m_Images = m_Images.toSet().toList();
-        
-        foreach (qboy::Palette *pal, m_Palettes)
-            delete pal;
-        
-        foreach (qboy::Image *img, m_Images)
-            delete img;
-        
-        m_Palettes.clear();
-        m_Images.clear();
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool OverworldTable::read(const qboy::Rom &rom)
+    bool OverworldTable::read(const RomCursor &rom)
     {
         // Attempts to load all the overworld palettes
-        QMap<UInt16, qboy::Palette *> paletteMap;
+        QMap<UInt16, QVector<QRgb>> paletteMap;
         bool reachedLimiter = false;
         for (int i = 0; !reachedLimiter; i++)
         {
@@ -133,8 +130,9 @@ namespace ame
                 reachedLimiter = true;
 
             // Loads the palette
-            qboy::Palette *palette = new qboy::Palette;
-            palette->readUncompressed(rom, ptrPal, 16);
+            QVector<QRgb> palette;
+            if (!GbaGraphics::readPalette(rom.data(), ptrPal, palette))
+                AME_THROW(OWT_ERROR_PALETTE, rom.redirected());
 
             // Adds the necessary values to the map
             paletteMap.insert(idxPal, palette);
@@ -142,8 +140,10 @@ namespace ame
 
 
         // Attempts to load the overworld images
+        QList<QSize> sizes;
         for (unsigned i = 0; i < CONFIG(OverworldCount); i++)
         {
+            AME_TRACE("overworld", QString("Overworld %1").arg(i));
             if (!rom.seek(CONFIG(Overworlds) + i * 4))
                 AME_THROW2(OWT_ERROR_OFFSET);
 
@@ -171,31 +171,28 @@ namespace ame
                 AME_THROW(OWT_ERROR_SPRITE, rom.redirected());
 
             // Reads the actual image
-            qboy::Image *image = new qboy::Image;
-            image->readUncompressed(rom, ptrImage, width*height/2, width, true);
+            QByteArray image;
+            if (!GbaGraphics::readImage(rom.data(), ptrImage, width, height, image))
+                AME_THROW(OWT_ERROR_SPRITE, rom.redirected());
 
             m_Images.push_back(image);
             m_Palettes.push_back(paletteMap.value(idxPal));
+            sizes.push_back(QSize(width, height));
         }
 
 
         // Converts all of these to ARGB images
         for (unsigned i = 0; i < CONFIG(OverworldCount); i++)
         {
-            const qboy::Image *img = m_Images.at(i);
-            const qboy::Palette *pal = m_Palettes.at(i);
+            const QByteArray &img = m_Images.at(i);
+            QVector<QRgb> cp = m_Palettes.at(i);
+            cp[0] = qRgba(0, 0, 0, 0);
 
-            QVector<QRgb> cp;
-            cp.push_back(qRgba(0, 0, 0, 0));
-            for (int i = 1; i < 16; i++)
-            {
-                qboy::Color c = pal->raw().at(i);
-                cp.push_back(qRgba(c.r, c.g, c.b, c.a));
-            }
-
-            QImage qi(img->size(), QImage::Format_Indexed8);
-            for (int i = 0; i < qi.byteCount(); i++)
-                qi.bits()[i] = (uchar)(img->raw().at(i));
+            // Copies the pixels line by line, as lines are aligned
+            const Int32 width = sizes.at(i).width();
+            QImage qi(sizes.at(i), QImage::Format_Indexed8);
+            for (int y = 0; y < qi.height(); y++)
+                memcpy(qi.scanLine(y), img.constData() + y * width, width);
 
             qi.setColorTable(cp);
             m_Argb.push_back(qi);
@@ -207,12 +204,12 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    const QList<qboy::Image *> &OverworldTable::images() const
+    const QList<QByteArray> &OverworldTable::images() const
     {
         return m_Images;
     }
@@ -231,12 +228,12 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    const QList<qboy::Palette *> &OverworldTable::palettes() const
+    const QList<QVector<QRgb>> &OverworldTable::palettes() const
     {
         return m_Palettes;
     }
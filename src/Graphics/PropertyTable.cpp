@@ -38,6 +38,7 @@
 #include <AME/System/Configuration.hpp>
 #include <AME/Graphics/GraphicsErrors.hpp>
 #include <AME/Graphics/PropertyTable.hpp>
+#include <QtEndian>
 
 
 namespace ame
@@ -50,6 +51,7 @@ namespace ame
     //
     ///////////////////////////////////////////////////////////
     PropertyTable::PropertyTable()
+        : m_Offset(0)
     {
     }
 
@@ -61,7 +63,9 @@ namespace ame
     //
     ///////////////////////////////////////////////////////////
     PropertyTable::PropertyTable(const PropertyTable &rvalue)
-        : m_Properties(rvalue.m_Properties)
+        : m_Offset(rvalue.m_Offset),
+          m_Behaviours(rvalue.m_Behaviours),
+          m_Backgrounds(rvalue.m_Backgrounds)
     {
     }
 
@@ -74,7 +78,9 @@ namespace ame
     ///////////////////////////////////////////////////////////
     PropertyTable &PropertyTable::operator=(const PropertyTable &rvalue)
     {
-        m_Properties = rvalue.m_Properties;
+        m_Offset = rvalue.m_Offset;
+        m_Behaviours = rvalue.m_Behaviours;
+        m_Backgrounds = rvalue.m_Backgrounds;
         return *this;
     }
 
@@ -87,43 +93,47 @@ namespace ame
     ///////////////////////////////////////////////////////////
     PropertyTable::~PropertyTable()
     {
-        foreach (Property *prop, m_Properties)
-            delete prop;
-
-        m_Properties.clear();
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/20/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // FRLG stores two half-words per block, RSE two bytes.
     //
     ///////////////////////////////////////////////////////////
-    bool PropertyTable::read(const qboy::Rom &rom, UInt32 offset, Int32 blocks)
+    bool PropertyTable::read(const RomCursor &rom, UInt32 offset, Int32 blocks)
     {
         if (!rom.seek(offset))
             AME_THROW(PPT_ERROR_OFFSET, rom.redirected());
 
+        const bool isFRLG = (CONFIG(RomType) == RT_FRLG);
+        const Int32 stride = (isFRLG) ? 4 : 2;
+        const RomData &data = rom.data();
+        if (!data.canRead(offset, blocks * stride))
+            AME_THROW(PPT_ERROR_OFFSET, offset);
+
 
-        // Reads all properties
-        for (int i = 0; i < blocks; i++)
+        // Reads all properties in one pass
+        const UInt8 *props = data.data() + offset;
+        m_Behaviours.resize(blocks);
+        m_Backgrounds.resize(blocks);
+        for (int i = 0; i < blocks; i++, props += stride)
         {
-            Property *prop = new Property;
-            if (CONFIG(RomType) == RT_FRLG)
+            if (isFRLG)
             {
-                prop->behaviour = rom.readByte();
-                prop->background = rom.readByte();
+                m_Behaviours[i] = qFromLittleEndian<quint16>(props);      // Lower -> behaviour
+                m_Backgrounds[i] = qFromLittleEndian<quint16>(props + 2); // Upper -> background
             }
             else
             {
-                prop->behaviour = rom.readHWord();  // Lower -> behaviour
-                prop->background = rom.readHWord(); // Upper -> background
+                m_Behaviours[i] = props[0];
+                m_Backgrounds[i] = props[1];
             }
-
-            // Adds the property
-            m_Properties.push_back(prop);
         }
 
 
@@ -134,13 +144,76 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/20/2016
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 PropertyTable::count() const
+    {
+        return m_Behaviours.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Property PropertyTable::property(Int32 block) const
+    {
+        Property prop;
+        prop.behaviour = m_Behaviours.at(block);
+        prop.background = m_Backgrounds.at(block);
+        return prop;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt16 PropertyTable::behaviour(Int32 block) const
+    {
+        return m_Behaviours.at(block);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt16 PropertyTable::background(Int32 block) const
+    {
+        return m_Backgrounds.at(block);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const QVector<UInt16> &PropertyTable::behaviours() const
+    {
+        return m_Behaviours;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    const QList<Property *> &PropertyTable::properties() const
+    const QVector<UInt16> &PropertyTable::backgrounds() const
     {
-        return m_Properties;
+        return m_Backgrounds;
     }
 }
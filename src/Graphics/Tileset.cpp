@@ -38,6 +38,11 @@
 #include <AME/System/Configuration.hpp>
 #include <AME/Graphics/GraphicsErrors.hpp>
 #include <AME/Graphics/Tileset.hpp>
+#include <AME/Graphics/GbaGraphics.hpp>
+#include <AME/Algorithm/Lz77.hpp>
+#include <AME/System/Tracer.hpp>
+#include <QtEndian>
+#include <QReadLocker>
 
 
 namespace ame
@@ -58,7 +63,9 @@ namespace ame
           m_PtrPalette(0),
           m_PtrAnimations(0),
           m_PtrBehaviour(0),
-          m_Image(new qboy::Image),
+          m_UncompSize(0),
+          m_Rom(NULL),
+          m_IsDecoded(false),
           m_Properties(new PropertyTable)
     {
     }
@@ -79,9 +86,12 @@ namespace ame
           m_PtrPalette(rvalue.m_PtrPalette),
           m_PtrAnimations(rvalue.m_PtrAnimations),
           m_PtrBehaviour(rvalue.m_PtrBehaviour),
-          m_Image(rvalue.m_Image),
+          m_UncompSize(rvalue.m_UncompSize),
+          m_Rom(rvalue.m_Rom),
+          m_Pixels(rvalue.m_Pixels),
+          m_IsDecoded(rvalue.m_IsDecoded),
           m_Pals(rvalue.m_Pals),
-          m_Blocks(rvalue.m_Blocks),
+          m_Tiles(rvalue.m_Tiles),
           m_Properties(rvalue.m_Properties)
     {
     }
@@ -102,41 +112,40 @@ namespace ame
         m_PtrPalette = rvalue.m_PtrPalette;
         m_PtrAnimations = rvalue.m_PtrAnimations;
         m_PtrBehaviour = rvalue.m_PtrBehaviour;
-        m_Image = rvalue.m_Image;
+        m_UncompSize = rvalue.m_UncompSize;
+        m_Rom = rvalue.m_Rom;
+        m_Pixels = rvalue.m_Pixels;
+        m_IsDecoded = rvalue.m_IsDecoded;
         m_Pals = rvalue.m_Pals;
-        m_Blocks = rvalue.m_Blocks;
+        m_Tiles = rvalue.m_Tiles;
         m_Properties = rvalue.m_Properties;
         return *this;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Destructor
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/7/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     Tileset::~Tileset()
     {
-        foreach (Block *block, m_Blocks)
-            delete block;
-        foreach (qboy::Palette *pal, m_Pals)
-            delete pal;
-
-        delete m_Image;
         delete m_Properties;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/5/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool Tileset::read(const qboy::Rom &rom, UInt32 offset)
+    bool Tileset::read(const RomCursor &rom, UInt32 offset)
     {
+        AME_TRACE("tileset", QString("Tileset 0x%1").arg(offset, 0, 16));
+
         if (!rom.seek(offset))
             AME_THROW(SET_ERROR_OFFSET, rom.redirected());
 
@@ -218,47 +227,29 @@ namespace ame
             AME_THROW(SET_ERROR_PROP, offset + 20);
 
 
-        // Attempts to load the image
-        if (m_IsCompressed)
-        {
-            if (!m_Image->readCompressed(rom, m_PtrImage, 128, true))
-                AME_THROW(SET_ERROR_IMGDATA, m_PtrImage);
-        }
-        else
-        {
-            if (!m_Image->readUncompressed(rom, m_PtrImage, uncompSize, 128, true))
-                AME_THROW(SET_ERROR_IMGDATA, m_PtrImage);
-        }
+        // The image is decoded on demand, see pixels()
+        m_UncompSize = uncompSize;
+        m_Rom = &rom.data();
 
         // Attempts to load the palettes
+        const RomData &data = rom.data();
         for (int i = 0; i < countPal; i++)
         {
-            qboy::Palette *pal = new qboy::Palette;
-            pal->readUncompressed(rom, m_PtrPalette + palAdjustment + i * 32, 16);
+            QVector<QRgb> pal;
+            if (!GbaGraphics::readPalette(data, m_PtrPalette + palAdjustment + i * 32, pal))
+                AME_THROW(SET_ERROR_PALETTE, offset + 8);
+
             m_Pals.push_back(pal);
         }
 
-        // Attempts to load the blocks
-        rom.seek(m_PtrBlocks);
-        for (int i = 0; i < countBlock; i++)
-        {
-            Block *block = new Block;
-            m_Blocks.push_back(block);
+        // Loads the tile words of all blocks in one go
+        if (!data.canRead(m_PtrBlocks, countBlock * 16))
+            AME_THROW(SET_ERROR_BLOCKS, offset + 12);
 
-            // Each block has 2 layers á 4 tiles
-            for (int j = 0; j < 8; j++)
-            {
-                Tile tile;
-                UInt16 data = rom.readHWord();
-
-                // Extracts information from the hword
-                tile.tile = (data & 0x3FF);
-                tile.palette = ((data & 0xF800) >> 0xC);
-                tile.flipX = ((data & 0x400) == 0x400);
-                tile.flipY = ((data & 0x800) == 0x800);
-                block->tiles[j] = tile;
-            }
-        }
+        const UInt8 *tiles = data.data() + m_PtrBlocks;
+        m_Tiles.resize(countBlock * 8);
+        for (int i = 0; i < countBlock * 8; i++)
+            m_Tiles[i] = qFromLittleEndian<quint16>(tiles + i * 2);
 
 
         // Attempts to load the block properties
@@ -271,6 +262,54 @@ namespace ame
     }
 
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // A failed decoding is not retried; the image stays empty
+    // and the error is pushed onto the error stack.
+    //
+    ///////////////////////////////////////////////////////////
+    bool Tileset::decodeImage() const
+    {
+        AME_TRACE("tileset", QString("Decode tileset 0x%1").arg(m_Offset, 0, 16));
+
+        m_IsDecoded = true;
+        if (m_Rom == NULL)
+            return false;
+
+        // Saving remaps the ROM; keeps it mapped until decoded
+        QReadLocker lock(m_Rom->mapLock());
+        QByteArray raw;
+        if (m_IsCompressed)
+        {
+            if (!Lz77::decompress(*m_Rom, m_PtrImage, raw))
+            {
+                AME_SILENT_THROW(SET_ERROR_IMGDATA, m_PtrImage);
+                return false;
+            }
+        }
+        else
+        {
+            if (!m_Rom->canRead(m_PtrImage, m_UncompSize))
+            {
+                AME_SILENT_THROW(SET_ERROR_IMGDATA, m_PtrImage);
+                return false;
+            }
+
+            raw = QByteArray::fromRawData(reinterpret_cast<const char *>(m_Rom->data()) + m_PtrImage, m_UncompSize);
+        }
+
+        // Converts the 4bpp tiles to a 128 pixels wide image
+        const UInt8 *tiles = reinterpret_cast<const UInt8 *>(raw.constData());
+        GbaGraphics::decodeTiles(tiles, raw.size() / 32, 128, m_Pixels);
+        return true;
+    }
+
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributers:   Pokedude
@@ -283,19 +322,31 @@ namespace ame
         return m_Offset;
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 Tileset::imageOffset() const
+    {
+        return m_PtrImage;
+    }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/7/2016
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    qboy::Image *Tileset::image() const
+    bool Tileset::isCompressed() const
     {
-        return m_Image;
+        return (m_IsCompressed != 0);
     }
 
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributers:   Pokedude
@@ -303,20 +354,140 @@ namespace ame
     // Date of edit:   6/7/2016
     //
     ///////////////////////////////////////////////////////////
-    const QList<qboy::Palette *> &Tileset::palettes() const
+    const QByteArray &Tileset::pixels() const
+    {
+        QMutexLocker lock(&m_DecodeMutex);
+        if (!m_IsDecoded)
+            decodeImage();
+
+        return m_Pixels;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QSize Tileset::imageSize() const
+    {
+        return QSize(128, pixels().size() / 128);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool Tileset::isDecoded() const
+    {
+        QMutexLocker lock(&m_DecodeMutex);
+        return m_IsDecoded;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const QList<QVector<QRgb>> &Tileset::palettes() const
     {
         return m_Pals;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/7/2016
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 Tileset::blockCount() const
+    {
+        return m_Tiles.size() / 8;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const UInt16 *Tileset::blockData() const
+    {
+        return m_Tiles.constData();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Tile Tileset::tile(Int32 block, Int32 index) const
+    {
+        UInt16 data = m_Tiles.at(block * 8 + index);
+
+        // Extracts information from the hword
+        Tile tile;
+        tile.tile = (data & 0x3FF);
+        tile.palette = ((data & 0xF000) >> 0xC);
+        tile.flipX = ((data & 0x400) == 0x400);
+        tile.flipY = ((data & 0x800) == 0x800);
+        return tile;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Block Tileset::block(Int32 index) const
+    {
+        Block block;
+        for (int i = 0; i < 8; i++)
+            block.tiles[i] = tile(index, i);
+
+        return block;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const PropertyTable &Tileset::properties() const
+    {
+        return *m_Properties;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    const QList<Block *> &Tileset::blocks() const
+    UInt32 Tileset::residentBytes() const
     {
-        return m_Blocks;
+        QMutexLocker lock(&m_DecodeMutex);
+        UInt32 bytes = m_Pixels.size();
+        foreach (const QVector<QRgb> &pal, m_Pals)
+            bytes += pal.size() * sizeof(QRgb);
+
+        bytes += m_Tiles.size() * sizeof(UInt16);
+        bytes += m_Properties->count() * sizeof(UInt16) * 2;
+        return bytes;
     }
 }
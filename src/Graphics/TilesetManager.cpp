@@ -31,11 +31,13 @@
 //////////////////////////////////////////////////////////////////////////////////
 
 
+
 ///////////////////////////////////////////////////////////
 // Include files
 //
 ///////////////////////////////////////////////////////////
 #include <AME/Graphics/TilesetManager.hpp>
+#include <QtConcurrent>
 
 
 namespace ame
@@ -44,52 +46,244 @@ namespace ame
     // Static variable definition
     //
     ///////////////////////////////////////////////////////////
-    QList<Tileset *> TilesetManager::m_Tilesets;
+    QHash<UInt32, TilesetUsage> TilesetManager::m_Tilesets;
+    Int32 TilesetManager::m_Hits = 0;
+    Int32 TilesetManager::m_Misses = 0;
+    QList<Tileset *> TilesetManager::m_Pending;
+    QFuture<void> TilesetManager::m_WarmUp;
+    QMutex TilesetManager::m_Mutex;
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/10/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    void TilesetManager::add(Tileset *tileset)
+    Tileset *TilesetManager::add(Tileset *tileset)
     {
-        m_Tilesets.push_back(tileset);
+        QMutexLocker lock(&m_Mutex);
+        QHash<UInt32, TilesetUsage>::iterator it = m_Tilesets.find(tileset->offset());
+        if (it != m_Tilesets.end())
+        {
+            it->references++;
+            return it->tileset;
+        }
+
+        TilesetUsage usage;
+        usage.tileset = tileset;
+        usage.references = 1;
+        usage.hits = 0;
+        usage.residentBytes = 0;
+        m_Tilesets.insert(tileset->offset(), usage);
+        return tileset;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/10/2016
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     Tileset *TilesetManager::get(UInt32 offset)
     {
-        int size = m_Tilesets.size();
-        for (int i = 0; i < size; i++)
-            if (m_Tilesets.at(i)->offset() == offset)
-                return m_Tilesets[i];
+        QMutexLocker lock(&m_Mutex);
+        QHash<UInt32, TilesetUsage>::iterator it = m_Tilesets.find(offset);
+        if (it == m_Tilesets.end())
+        {
+            m_Misses++;
+            return NULL;
+        }
 
-        return NULL;
+        m_Hits++;
+        it->hits++;
+        it->references++;
+        return it->tileset;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void TilesetManager::acquire(Tileset *tileset)
+    {
+        if (tileset == NULL)
+            return;
+
+        QMutexLocker lock(&m_Mutex);
+        QHash<UInt32, TilesetUsage>::iterator it = m_Tilesets.find(tileset->offset());
+        if (it != m_Tilesets.end() && it->tileset == tileset)
+            it->references++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Tilesets that are not managed (e.g. freed by clear()
+    // already) are ignored.
+    //
+    ///////////////////////////////////////////////////////////
+    void TilesetManager::release(Tileset *tileset)
+    {
+        if (tileset == NULL)
+            return;
+
+        QMutexLocker lock(&m_Mutex);
+        QHash<UInt32, TilesetUsage>::iterator it = m_Tilesets.find(tileset->offset());
+        if (it == m_Tilesets.end() || it->tileset != tileset)
+            return;
+
+        if (--it->references <= 0)
+        {
+            m_Tilesets.erase(it);
+            delete tileset;
+        }
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributers:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/10/2016
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every pending tileset is acquired before decoding starts
+    // and released afterwards, so it cannot be freed meanwhile.
+    // Only the requested tilesets are decoded; all others stay
+    // encoded until they are drawn for the first time.
+    //
+    ///////////////////////////////////////////////////////////
+    void TilesetManager::warmUp(const QList<Tileset *> &tilesets)
+    {
+        // The list is iterated by the previous run, if any
+        m_WarmUp.waitForFinished();
+        m_Pending.clear();
+
+        {
+            QMutexLocker lock(&m_Mutex);
+            foreach (Tileset *tileset, tilesets)
+            {
+                if (tileset == NULL || m_Pending.contains(tileset) || tileset->isDecoded())
+                    continue;
+
+                QHash<UInt32, TilesetUsage>::iterator it = m_Tilesets.find(tileset->offset());
+                if (it == m_Tilesets.end() || it->tileset != tileset)
+                    continue;
+
+                it->references++;
+                m_Pending.push_back(tileset);
+            }
+        }
+
+        if (m_Pending.isEmpty())
+            return;
+
+        m_WarmUp = QtConcurrent::map(m_Pending, [](Tileset *tileset)
+        {
+            tileset->pixels();
+            release(tileset);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributers:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The background decoding releases tilesets and therefore
+    // needs the mutex; it must be stopped before locking.
     //
     ///////////////////////////////////////////////////////////
     void TilesetManager::clear()
     {
-        foreach (Tileset *tileset, m_Tilesets)
-            delete tileset;
+        m_WarmUp.cancel();
+        m_WarmUp.waitForFinished();
+        m_Pending.clear();
+
+        QMutexLocker lock(&m_Mutex);
+        foreach (const TilesetUsage &usage, m_Tilesets)
+            delete usage.tileset;
 
         m_Tilesets.clear();
+        m_Hits = 0;
+        m_Misses = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 TilesetManager::hits()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Hits;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 TilesetManager::misses()
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Misses;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    TilesetUsage TilesetManager::usage(UInt32 offset)
+    {
+        QMutexLocker lock(&m_Mutex);
+        TilesetUsage usage = m_Tilesets.value(offset);
+        if (usage.tileset != NULL)
+            usage.residentBytes = usage.tileset->residentBytes();
+
+        return usage;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<TilesetUsage> TilesetManager::usages()
+    {
+        QMutexLocker lock(&m_Mutex);
+        QList<TilesetUsage> list;
+        foreach (TilesetUsage usage, m_Tilesets)
+        {
+            usage.residentBytes = usage.tileset->residentBytes();
+            list.push_back(usage);
+        }
+
+        return list;
     }
 }
@@ -0,0 +1,290 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/BlockReplace.hpp>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QSet>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Removes duplicates and placeholder layouts, so that no
+    // grid is ever modified by two tasks.
+    //
+    ///////////////////////////////////////////////////////////
+    inline QList<MapHeader *> AME_BR_Unique(const QList<MapHeader *> &headers)
+    {
+        QList<MapHeader *> unique;
+        QSet<MapHeader *> seen;
+        foreach (MapHeader *header, headers)
+        {
+            if (header == NULL || header->offset() == 0 || seen.contains(header))
+                continue;
+
+            seen.insert(header);
+            unique.push_back(header);
+        }
+
+        return unique;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The rule is turned into masks once, so that matching and
+    // replacing a cell needs no branches.
+    //
+    ///////////////////////////////////////////////////////////
+    BlockReplace::BlockReplace(const ReplaceRule &rule)
+        : IUndoable(),
+          m_Rule(rule),
+          m_MatchMask(0),
+          m_MatchValue(0),
+          m_KeepMask(0xFFFF),
+          m_WriteValue(0)
+    {
+        if (rule.block >= 0)
+        {
+            m_MatchMask |= MBG_BLOCK_MASK;
+            m_MatchValue |= (rule.block & MBG_BLOCK_MASK);
+        }
+        if (rule.permission >= 0)
+        {
+            m_MatchMask |= ~MBG_BLOCK_MASK & 0xFFFF;
+            m_MatchValue |= (rule.permission << MBG_PERM_SHIFT) & 0xFFFF;
+        }
+        if (rule.replacement.block >= 0)
+        {
+            m_KeepMask &= ~MBG_BLOCK_MASK;
+            m_WriteValue |= (rule.replacement.block & MBG_BLOCK_MASK);
+        }
+        if (rule.replacement.permission >= 0)
+        {
+            m_KeepMask &= MBG_BLOCK_MASK;
+            m_WriteValue |= (rule.replacement.permission << MBG_PERM_SHIFT) & 0xFFFF;
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool BlockReplace::accepts(const MapHeader *header) const
+    {
+        return (m_Rule.tileset == 0 ||
+                header->ptrPrimary() == m_Rule.tileset ||
+                header->ptrSecondary() == m_Rule.tileset);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<ReplaceCount> BlockReplace::preview(const QList<MapHeader *> &headers) const
+    {
+        QList<ReplaceCount> counts;
+        foreach (MapHeader *header, AME_BR_Unique(headers))
+        {
+            ReplaceCount count;
+            count.header = header;
+            count.cells = 0;
+            if (accepts(header))
+                counts.push_back(count);
+        }
+
+        // Counts the cells of every layout on the global thread pool
+        QtConcurrent::blockingMap(counts, [this](ReplaceCount &count) {
+            const MapBlockGrid &grid = count.header->blocks();
+            const UInt16 *cells = grid.data();
+            for (int i = 0; i < grid.size(); i++)
+            {
+                const UInt16 cell = cells[i];
+                if ((cell & m_MatchMask) == m_MatchValue && ((cell & m_KeepMask) | m_WriteValue) != cell)
+                    count.cells++;
+            }
+        });
+
+        QList<ReplaceCount> result;
+        foreach (const ReplaceCount &count, counts)
+            if (count.cells != 0)
+                result.push_back(count);
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 BlockReplace::apply(const QList<MapHeader *> &headers)
+    {
+        QList<Change> changes;
+        foreach (MapHeader *header, AME_BR_Unique(headers))
+        {
+            Change change;
+            change.header = header;
+            if (accepts(header))
+                changes.push_back(change);
+        }
+
+        // Every task owns the grid of exactly one layout
+        QtConcurrent::blockingMap(changes, [this](Change &change) {
+            MapBlockGrid &grid = change.header->blocks();
+            UInt16 *cells = grid.data();
+            for (int i = 0; i < grid.size(); i++)
+            {
+                const UInt16 cell = cells[i];
+                const UInt16 replaced = (cell & m_KeepMask) | m_WriteValue;
+                if ((cell & m_MatchMask) != m_MatchValue || replaced == cell)
+                    continue;
+
+                change.cells.push_back(i);
+                change.before.push_back(cell);
+                change.after.push_back(replaced);
+                cells[i] = replaced;
+            }
+        });
+
+        Int32 total = 0;
+        m_Changes.clear();
+        foreach (const Change &change, changes)
+        {
+            if (change.cells.isEmpty())
+                continue;
+
+            change.header->setModified(true);
+            m_Changes.push_back(change);
+            total += change.cells.size();
+        }
+
+        return total;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Virtual
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlockReplace::undo()
+    {
+        foreach (const Change &change, m_Changes)
+        {
+            UInt16 *cells = change.header->blocks().data();
+            for (int i = 0; i < change.cells.size(); i++)
+                cells[change.cells.at(i)] = change.before.at(i);
+
+            change.header->setModified(true);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Virtual
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void BlockReplace::redo()
+    {
+        foreach (const Change &change, m_Changes)
+        {
+            UInt16 *cells = change.header->blocks().data();
+            for (int i = 0; i < change.cells.size(); i++)
+                cells[change.cells.at(i)] = change.after.at(i);
+
+            change.header->setModified(true);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<WriteEntry> BlockReplace::write() const
+    {
+        QList<WriteEntry> entries;
+        foreach (const Change &change, m_Changes)
+        {
+            WriteEntry entry(change.header->ptrBlocks());
+            entry.data = change.header->blocks().rawData();
+            entries.push_back(entry);
+        }
+
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 BlockReplace::layoutCount() const
+    {
+        return m_Changes.size();
+    }
+}
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/LayoutManager.hpp>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Static variable definition
+    //
+    ///////////////////////////////////////////////////////////
+    QHash<UInt32, MapHeader *> LayoutManager::m_Layouts;
+    QMutex LayoutManager::m_Mutex;
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *LayoutManager::add(MapHeader *layout)
+    {
+        QMutexLocker lock(&m_Mutex);
+        MapHeader *existing = m_Layouts.value(layout->offset(), NULL);
+        if (existing != NULL)
+            return existing;
+
+        m_Layouts.insert(layout->offset(), layout);
+        return layout;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *LayoutManager::get(UInt32 offset)
+    {
+        QMutexLocker lock(&m_Mutex);
+        return m_Layouts.value(offset, NULL);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *LayoutManager::load(const RomCursor &rom, UInt32 offset)
+    {
+        MapHeader *layout = get(offset);
+        if (layout != NULL)
+            return layout;
+
+        layout = new MapHeader;
+        if (!layout->read(rom, offset))
+        {
+            delete layout;
+            return NULL;
+        }
+
+        // Another thread might have loaded it meanwhile
+        MapHeader *shared = add(layout);
+        if (shared != layout)
+            delete layout;
+
+        return shared;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<MapHeader *> LayoutManager::modified()
+    {
+        QMutexLocker lock(&m_Mutex);
+        QList<MapHeader *> layouts;
+        foreach (MapHeader *layout, m_Layouts)
+            if (layout->isModified())
+                layouts.push_back(layout);
+
+        return layouts;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributers:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void LayoutManager::clear()
+    {
+        QMutexLocker lock(&m_Mutex);
+        foreach (MapHeader *layout, m_Layouts)
+            delete layout;
+
+        m_Layouts.clear();
+    }
+}
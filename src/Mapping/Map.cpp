@@ -38,7 +38,9 @@
 #include <AME/System/Configuration.hpp>
 #include <AME/Mapping/MappingErrors.hpp>
 #include <AME/Mapping/Map.hpp>
+#include <AME/Mapping/LayoutManager.hpp>
 #include <AME/Text/String.hpp>
+#include <AME/System/Tracer.hpp>
 
 
 namespace ame
@@ -67,8 +69,10 @@ namespace ame
           m_MiscByte2(0),
           m_MiscByte3(0),
           m_BattleType(0),
+          m_Header(NULL),
           m_WildTable(-1),
-          m_TreeViewIndex(NULL)
+          m_TreeViewIndex(NULL),
+          m_IsLoaded(false)
     {
     }
 
@@ -100,7 +104,9 @@ namespace ame
           m_Events(rvalue.m_Events),
           m_Scripts(rvalue.m_Scripts),
           m_Connections(rvalue.m_Connections),
-          m_WildTable(rvalue.m_WildTable)
+          m_WildTable(rvalue.m_WildTable),
+          m_TreeViewIndex(rvalue.m_TreeViewIndex),
+          m_IsLoaded(rvalue.m_IsLoaded)
     {
     }
 
@@ -133,6 +139,8 @@ namespace ame
         m_Scripts = rvalue.m_Scripts;
         m_Connections = rvalue.m_Connections;
         m_WildTable = rvalue.m_WildTable;
+        m_TreeViewIndex = rvalue.m_TreeViewIndex;
+        m_IsLoaded = rvalue.m_IsLoaded;
         return *this;
     }
 
@@ -150,13 +158,19 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/12/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Only reads the 28-byte map structure; all tables are
+    // parsed on demand by Map::load.
     //
     ///////////////////////////////////////////////////////////
-    bool Map::read(const qboy::Rom &rom, UInt32 offset)
+    bool Map::read(const RomCursor &rom, UInt32 offset)
     {
+        AME_TRACE("map", QString("Map 0x%1").arg(offset, 0, 16));
+
         if (!rom.seek(offset))
             AME_THROW(MAP_ERROR_OFFSET, rom.redirected());
 
@@ -177,8 +191,40 @@ namespace ame
             AME_THROW(MAP_ERROR_CONNEX, offset + 12);
 
 
-        // Attempts to read the header data
-        if (!m_Header.read(rom, m_PtrHeader))
+        // Reads all remaining map properties
+        m_MusicID = rom.readHWord();
+        m_HeaderID = rom.readHWord();
+        m_NameIndex = rom.readByte();
+        m_DarknessType = rom.readByte();
+        m_WeatherType = rom.readByte();
+        m_MapType = rom.readByte();
+        m_MiscByte1 = rom.readByte();
+        m_MiscByte2 = rom.readByte();
+        m_MiscByte3 = rom.readByte();
+        m_BattleType = rom.readByte();
+
+        m_Offset = offset;
+        m_IsLoaded = false;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool Map::load(const RomCursor &rom)
+    {
+        if (m_IsLoaded)
+            return true;
+
+        AME_TRACE("map", QString("Load map 0x%1").arg(m_Offset, 0, 16));
+
+        // Attempts to read the header data, which is shared
+        // with the layout table and all other maps using it
+        if ((m_Header = LayoutManager::load(rom, m_PtrHeader)) == NULL)
             return false;
 
         // Attempts to read the events
@@ -196,22 +242,32 @@ namespace ame
             if (!m_Connections.read(rom, m_PtrConnections))
                 return false;
 
+        m_IsLoaded = true;
+        return true;
+    }
 
-        // Reads all remaining map properties
-        rom.seek(offset + 16);
-        m_MusicID = rom.readHWord();
-        m_HeaderID = rom.readHWord();
-        m_NameIndex = rom.readByte();
-        m_DarknessType = rom.readByte();
-        m_WeatherType = rom.readByte();
-        m_MapType = rom.readByte();
-        m_MiscByte1 = rom.readByte();
-        m_MiscByte2 = rom.readByte();
-        m_MiscByte3 = rom.readByte();
-        m_BattleType = rom.readByte();
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool Map::isLoaded() const
+    {
+        return m_IsLoaded;
+    }
 
-        m_Offset = offset;
-        return true;
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 Map::offset() const
+    {
+        return m_Offset;
     }
 
 
@@ -224,7 +280,8 @@ namespace ame
     ///////////////////////////////////////////////////////////
     MapHeader &Map::header()
     {
-        return m_Header;
+        Q_ASSERT(m_Header != NULL);
+        return *m_Header;
     }
 
     ///////////////////////////////////////////////////////////
@@ -37,12 +37,98 @@
 ///////////////////////////////////////////////////////////
 #include <AME/System/Configuration.hpp>
 #include <AME/System/Settings.hpp>
+#include <AME/System/Tracer.hpp>
 #include <AME/Mapping/MappingErrors.hpp>
 #include <AME/Mapping/MapBank.hpp>
+#include <QHash>
 
 
 namespace ame
 {
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Returns -1 if the compression byte is invalid and the
+    // secondary-flag of the tileset otherwise.
+    //
+    ///////////////////////////////////////////////////////////
+    inline Int32 AME_MB_TilesetType(const RomData &data, UInt32 tileset, QHash<UInt32, Int32> &cache)
+    {
+        QHash<UInt32, Int32>::const_iterator it = cache.constFind(tileset);
+        if (it != cache.constEnd())
+            return it.value();
+
+        Int32 type = -1;
+        if (data.readByte(tileset) < 2) // compression can only be 0/1
+            type = data.readByte(tileset + 1);
+
+        cache.insert(tileset, type);
+        return type;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Performs the checks of level 2 and 4, which only depend
+    // on the layout header and can therefore be cached.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_MB_CheckLayout(const RomData &data, UInt32 footer, int accLevel,
+                                   QHash<UInt32, bool> &layouts, QHash<UInt32, Int32> &tilesets)
+    {
+        QHash<UInt32, bool>::const_iterator it = layouts.constFind(footer);
+        if (it != layouts.constEnd())
+            return it.value();
+
+        // Checks if the border, blocks, primary and secondary pointers are valid
+        UInt32 primary = data.readPointer(footer + 16);
+        UInt32 secondary = data.readPointer(footer + 20);
+        bool valid = (data.checkOffset(data.readPointer(footer + 8))  &&
+                      data.checkOffset(data.readPointer(footer + 12)) &&
+                      data.checkOffset(primary)                        &&
+                      data.checkOffset(secondary));
+
+        // Checks the first two tileset settings
+        if (valid && accLevel >= 4)
+        {
+            valid = (AME_MB_TilesetType(data, primary, tilesets) == 0 &&   // must be primary tileset!
+                     AME_MB_TilesetType(data, secondary, tilesets) == 1);  // must be secondary tileset!
+        }
+
+        layouts.insert(footer, valid);
+        return valid;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_MB_CheckEvents(const RomData &data, UInt32 events)
+    {
+        // Events are not necessary for a map
+        if (!events)
+            return true;
+
+        // Checks if the npc, warp, trigger and sign pointers are valid
+        for (int i = 0; i < 4; i++)
+            if (!data.checkOffset(data.readPointer(events + 4 + i * 4)))
+                return false;
+
+        return true;
+    }
+
+
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
     // Contributors:   Pokedude
@@ -101,13 +187,15 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/15/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool MapBank::read(const qboy::Rom &rom, UInt32 offset, UInt32 next)
+    bool MapBank::read(const RomCursor &rom, UInt32 offset, UInt32 next)
     {
+        AME_TRACE("bank", QString("Bank 0x%1").arg(offset, 0, 16));
+
         if (!rom.seek(offset))
             AME_THROW(BNK_ERROR_OFFSET, rom.redirected());
 
@@ -120,130 +208,99 @@ namespace ame
         // Level 3: Checks for ptr validity within the events +
         // Level 4: Checks certain properties in tilesets and events
         int accLevel = SETTINGS(MapAccuracyLevel);
+        const RomData &data = rom.data();
+
+        // Many maps share their layout and tilesets; these
+        // are only checked once per bank
+        QHash<UInt32, bool> layouts;
+        QHash<UInt32, Int32> tilesets;
 
-        // Retrieves the map count through various checks
+        // Retrieves the map count and reads every map that
+        // passed all checks right away
         while (true)
         {
-            if (!rom.seek(offset + (++m_Count) * 4))
-                AME_THROW(BNK_ERROR_WHILE, offset + m_Count * 4);
+            UInt32 entry = offset + (++m_Count) * 4;
+            if (!data.checkOffset(entry))
+                AME_THROW(BNK_ERROR_WHILE, entry);
 
             // =============  LEVEL 0  =============
             // Checks if current offset is start of bank table
-            if (rom.offset() == CONFIG(MapBanks))
+            if (entry == CONFIG(MapBanks))
                 break;
 
             // Checks if current offset is next bank
-            if (rom.offset() == next)
+            if (entry == next)
                 break;
 
             // Checks if map pointer is valid
-            unsigned map = rom.readPointer();
-            if (!rom.seek(map))
-                break;
-
-
-            // =============  LEVEL 1  =============
-            if (accLevel == 0)
-                continue;
-
-            // Checks if the layout header and event pointers are valid
-            unsigned footer = rom.readPointer();
-            if (!rom.checkOffset(footer))
+            UInt32 map = data.readPointer(entry);
+            if (!data.checkOffset(map))
                 break;
 
-            unsigned events = rom.readPointer();
-            if (!rom.checkOffset(events))
-                break;
-
-
-            // =============  LEVEL 2  =============
-            if (accLevel == 1)
-                continue;
-
-            // Checks if the border, blocks, primary and secondary pointers are valid
-            rom.seek(footer);
-            rom.readWord();
-            rom.readWord();
-            if (!rom.checkOffset(rom.readPointer()))
-                break;
-
-            if (!rom.checkOffset(rom.readPointer()))
-                break;
-
-            unsigned primary = rom.readPointer();
-            if (!rom.checkOffset(primary))
-                break;
-
-            unsigned secondary = rom.readPointer();
-            if (!rom.checkOffset(secondary))
-                break;
-
-
-            // =============  LEVEL 3  =============
-            if (accLevel == 2)
-                continue;
-
-            // Checks if the npc, warp, trigger and sign pointers are valid
-            // Events are not necessary for a map
-            if (events)
+            if (accLevel >= 1)
             {
-                rom.seek(events);
-                rom.readWord();
-                if (!rom.checkOffset(rom.readPointer()))
-                    break;
-    
-                if (!rom.checkOffset(rom.readPointer()))
+                // =============  LEVEL 1  =============
+                // Checks if the layout header and event pointers are valid
+                UInt32 footer = data.readPointer(map);
+                UInt32 events = data.readPointer(map + 4);
+                if (!data.checkOffset(footer) || !data.checkOffset(events))
                     break;
-    
-                if (!rom.checkOffset(rom.readPointer()))
+
+                // =============  LEVEL 2 & 4  =============
+                if (accLevel >= 2 && !AME_MB_CheckLayout(data, footer, accLevel, layouts, tilesets))
                     break;
-    
-                if (!rom.checkOffset(rom.readPointer()))
+
+                // =============  LEVEL 3  =============
+                if (accLevel >= 3 && !AME_MB_CheckEvents(data, events))
                     break;
             }
 
 
-            // =============  LEVEL 4  =============
-            if (accLevel == 3)
-                continue;
-
-            // Checks the first two tileset settings
-            rom.seek(primary);
-            if (rom.readByte() >= 2) // compression can only be 0/1
-                break;
-            if (rom.readByte() != 0) // must be primary tileset!
-                break;
+            // Attempts to read the map
+            Map *mapObj = new Map;
+            rom.seek(entry);
+            if (!mapObj->read(rom, rom.readPointerRef()))
+            {
+                delete mapObj;
+                return false;
+            }
 
-            rom.seek(secondary);
-            if (rom.readByte() >= 2) // compression can only be 0/1
-                break;
-            if (rom.readByte() != 1) // must be secondary tileset!
-                break;
+            m_Maps.push_back(mapObj);
         }
 
 
-        // Now attempts to read all the maps
-        for (int i = 0; i < m_Count; i++)
-        {
-            rom.seek(offset + i * 4);
+        // Loading successful
+        m_Offset = offset;
+        return true;
+    }
 
-            // Retrieves the pointer to the map
-            Map *map = new Map;
-            UInt32 mapOff = rom.readPointerRef();
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapBank::restore(const RomCursor &rom, UInt32 offset, const UInt32 *maps, UInt32 count)
+    {
+        AME_TRACE("bank", QString("Bank 0x%1").arg(offset, 0, 16));
 
-            // Attempts to read the map
-            if (!map->read(rom, mapOff))
+        for (UInt32 i = 0; i < count; i++)
+        {
+            Map *mapObj = new Map;
+            if (!mapObj->read(rom, maps[i]))
             {
-                delete map;
+                delete mapObj;
                 return false;
             }
 
-            m_Maps.push_back(map);
+            m_Maps.push_back(mapObj);
         }
 
 
         // Loading successful
         m_Offset = offset;
+        m_Count = count;
         return true;
     }
 
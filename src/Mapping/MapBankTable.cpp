@@ -37,6 +37,8 @@
 ///////////////////////////////////////////////////////////
 #include <AME/Mapping/MappingErrors.hpp>
 #include <AME/Mapping/MapBankTable.hpp>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QFutureSynchronizer>
 
 
 namespace ame
@@ -99,12 +101,12 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/15/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool MapBankTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool MapBankTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(MBT_ERROR_OFFSET, rom.redirected());
@@ -128,7 +130,9 @@ namespace ame
         }
 
 
-        // Reads all the banks
+        // Reads all the banks concurrently, each through a copy
+        // of the cursor that points behind the bank pointers
+        QFutureSynchronizer<bool> tasks;
         for (int i = 0; i < m_Count; i++)
         {
             rom.seek(offset + i * 4);
@@ -137,19 +141,55 @@ namespace ame
             UInt32 bankC = rom.readPointerRef();
             UInt32 bankN = rom.readPointer();
             MapBank *bank = new MapBank;
+            m_Banks.push_back(bank);
+
+            tasks.addFuture(QtConcurrent::run([rom, bank, bankC, bankN]() {
+                return bank->read(rom, bankC, bankN);
+            }));
+        }
 
-            if (!bank->read(rom, bankC, bankN))
-            {
-                delete bank;
+        tasks.waitForFinished();
+        foreach (const QFuture<bool> &task, tasks.futures())
+            if (!task.result())
                 return false;
-            }
 
+
+        // Loading successful
+        m_Offset = offset;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapBankTable::restore(const RomCursor &rom, UInt32 offset, const IndexCache &index)
+    {
+        QFutureSynchronizer<bool> tasks;
+        for (UInt32 i = 0; i < index.bankCount(); i++)
+        {
+            const IndexBank &entry = index.banks()[i];
+            const UInt32 *maps = index.maps() + entry.first;
+            MapBank *bank = new MapBank;
             m_Banks.push_back(bank);
+
+            tasks.addFuture(QtConcurrent::run([rom, bank, entry, maps]() {
+                return bank->restore(rom, entry.offset, maps, entry.count);
+            }));
         }
 
+        tasks.waitForFinished();
+        foreach (const QFuture<bool> &task, tasks.futures())
+            if (!task.result())
+                return false;
+
 
         // Loading successful
         m_Offset = offset;
+        m_Count = index.bankCount();
         return true;
     }
 
@@ -0,0 +1,298 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/MapBlockGrid.hpp>
+#include <QtEndian>
+#include <cstring>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapBlockGrid::MapBlockGrid()
+        : m_Width(0),
+          m_Height(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The cells are copied straight from the ROM; on big-endian
+    // hosts the half-words need to be swapped one by one. The
+    // dimensions come from the ROM as well and are checked
+    // before they are multiplied in 32 bits.
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapBlockGrid::read(const RomCursor &rom, UInt32 offset, Int32 width, Int32 height)
+    {
+        if (width <= 0 || height <= 0 || width > MBG_MAX_SIZE || height > MBG_MAX_SIZE)
+            return false;
+
+        const RomData &data = rom.data();
+        const quint64 bytes = static_cast<quint64>(width) * static_cast<quint64>(height) * 2;
+        if (bytes > data.size() || !data.canRead(offset, static_cast<UInt32>(bytes)))
+            return false;
+
+        const UInt32 count = static_cast<UInt32>(bytes / 2);
+
+        resize(width, height);
+
+    #if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        std::memcpy(m_Cells.data(), data.data() + offset, count * 2);
+    #else
+        const UInt8 *source = data.data() + offset;
+        for (UInt32 i = 0; i < count; i++)
+            m_Cells[i] = qFromLittleEndian<quint16>(source + i * 2);
+    #endif
+
+        rom.seek(offset + count * 2);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapBlockGrid::resize(Int32 width, Int32 height)
+    {
+        m_Width = width;
+        m_Height = height;
+        m_Cells.fill(0, width * height);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 MapBlockGrid::width() const
+    {
+        return m_Width;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 MapBlockGrid::height() const
+    {
+        return m_Height;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    Int32 MapBlockGrid::size() const
+    {
+        return m_Cells.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapBlockGrid::contains(Int32 x, Int32 y) const
+    {
+        return (x >= 0 && x < m_Width && y >= 0 && y < m_Height);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapBlock MapBlockGrid::at(Int32 index) const
+    {
+        const UInt16 cell = m_Cells.at(index);
+
+        MapBlock block;
+        block.block = (cell & MBG_BLOCK_MASK);
+        block.permission = (cell >> MBG_PERM_SHIFT);
+        return block;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapBlock MapBlockGrid::at(Int32 x, Int32 y) const
+    {
+        return at(x + y * m_Width);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt16 MapBlockGrid::block(Int32 x, Int32 y) const
+    {
+        return (m_Cells.at(x + y * m_Width) & MBG_BLOCK_MASK);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt8 MapBlockGrid::permission(Int32 x, Int32 y) const
+    {
+        return (m_Cells.at(x + y * m_Width) >> MBG_PERM_SHIFT);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapBlockGrid::set(Int32 x, Int32 y, const MapBlock &block)
+    {
+        m_Cells[x + y * m_Width] = ((block.block & MBG_BLOCK_MASK) | (block.permission << MBG_PERM_SHIFT));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapBlockGrid::setBlock(Int32 x, Int32 y, UInt16 block)
+    {
+        UInt16 &cell = m_Cells[x + y * m_Width];
+        cell = ((cell & ~MBG_BLOCK_MASK) | (block & MBG_BLOCK_MASK));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapBlockGrid::setPermission(Int32 x, Int32 y, UInt8 permission)
+    {
+        UInt16 &cell = m_Cells[x + y * m_Width];
+        cell = ((cell & MBG_BLOCK_MASK) | (permission << MBG_PERM_SHIFT));
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt16 *MapBlockGrid::data()
+    {
+        return m_Cells.data();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const UInt16 *MapBlockGrid::data() const
+    {
+        return m_Cells.constData();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QByteArray MapBlockGrid::rawData() const
+    {
+        QByteArray ba;
+        ba.reserve(m_Cells.size() * 2);
+        foreach (UInt16 cell, m_Cells)
+        {
+            ba.append((Int8)(cell & 0xFF));
+            ba.append((Int8)(cell >> 0x8));
+        }
+
+        return ba;
+    }
+}
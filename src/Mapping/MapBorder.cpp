@@ -106,7 +106,7 @@ namespace ame
     // Date of edit:   6/11/2016
     //
     ///////////////////////////////////////////////////////////
-    bool MapBorder::read(const qboy::Rom &rom, UInt32 offset, const QSize &size)
+    bool MapBorder::read(const RomCursor &rom, UInt32 offset, const QSize &size)
     {
         if (!rom.seek(offset))
             AME_THROW(BRD_ERROR_OFFSET, rom.redirected());
@@ -0,0 +1,396 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Mapping/MapFill.hpp>
+#include <QElapsedTimer>
+#include <QtAlgorithms>
+#include <QPair>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define AME_MF_SSE2
+#endif
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt16 AME_MF_Key(UInt16 cell, bool permissions)
+    {
+        return (permissions) ? (cell >> MBG_PERM_SHIFT) : (cell & MBG_BLOCK_MASK);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Combines the pattern entry with the cell; negative parts
+    // of the entry leave the cell untouched.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt16 AME_MF_Apply(UInt16 cell, const MapBlock &entry)
+    {
+        if (entry.block >= 0)
+            cell = static_cast<UInt16>((cell & ~MBG_BLOCK_MASK) | (entry.block & MBG_BLOCK_MASK));
+        if (entry.permission >= 0)
+            cell = static_cast<UInt16>((cell & MBG_BLOCK_MASK) | (entry.permission << MBG_PERM_SHIFT));
+
+        return cell;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Retrieves the bits of a cell that AME_MF_Apply keeps.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt16 AME_MF_Keep(const MapBlock &entry)
+    {
+        UInt16 keep = 0xFFFF;
+        if (entry.block >= 0)
+            keep &= ~MBG_BLOCK_MASK;
+        if (entry.permission >= 0)
+            keep &= MBG_BLOCK_MASK;
+
+        return keep;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline Int32 AME_MF_Wrap(Int32 value, Int32 size)
+    {
+        value %= size;
+        return (value < 0) ? value + size : value;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every popped seed is widened to the whole span of matching
+    // cells in its row; the rows above and below only receive
+    // one new seed per run of matching cells. Filled cells are
+    // marked as visited, so a pattern that writes the matched
+    // key again cannot cause the area to be filled twice.
+    //
+    ///////////////////////////////////////////////////////////
+    QRect MapFill::flood(MapBlockGrid &grid, const QPoint &start, const QVector<MapBlock> &pattern,
+                         const QSize &patternSize, bool permissions, QVector<Int32> *changed)
+    {
+        const Int32 width = grid.width();
+        const Int32 height = grid.height();
+        if (!grid.contains(start.x(), start.y()) || patternSize.isEmpty() ||
+             pattern.size() < patternSize.width() * patternSize.height())
+            return QRect();
+
+        UInt16 *cells = grid.data();
+        const UInt16 key = AME_MF_Key(cells[start.x() + start.y() * width], permissions);
+        QVector<UInt8> visited(width * height, 0);
+        QVector<QPair<Int32, Int32>> seeds;
+        seeds.push_back(qMakePair(start.x(), start.y()));
+
+        Int32 left = width, top = height, right = -1, bottom = -1;
+        while (!seeds.isEmpty())
+        {
+            const QPair<Int32, Int32> seed = seeds.takeLast();
+            const Int32 y = seed.second;
+            UInt16 *row = cells + y * width;
+            UInt8 *done = visited.data() + y * width;
+            if (done[seed.first] || AME_MF_Key(row[seed.first], permissions) != key)
+                continue;
+
+            // Widens the seed to the whole span
+            Int32 spanLeft = seed.first;
+            Int32 spanRight = seed.first;
+            while (spanLeft > 0 && !done[spanLeft - 1] && AME_MF_Key(row[spanLeft - 1], permissions) == key)
+                spanLeft--;
+            while (spanRight < width - 1 && !done[spanRight + 1] && AME_MF_Key(row[spanRight + 1], permissions) == key)
+                spanRight++;
+
+            // Writes the pattern to the span
+            const MapBlock *patternRow = pattern.constData()
+                    + AME_MF_Wrap(y - start.y(), patternSize.height()) * patternSize.width();
+            Int32 column = AME_MF_Wrap(spanLeft - start.x(), patternSize.width());
+            for (int x = spanLeft; x <= spanRight; x++)
+            {
+                const UInt16 cell = AME_MF_Apply(row[x], patternRow[column]);
+                if (cell != row[x])
+                {
+                    row[x] = cell;
+                    left = qMin(left, x);
+                    right = qMax(right, x);
+                    top = qMin(top, y);
+                    bottom = qMax(bottom, y);
+                    if (changed != NULL)
+                        changed->push_back(x + y * width);
+                }
+
+                done[x] = 1;
+                if (++column == patternSize.width())
+                    column = 0;
+            }
+
+            // Seeds one cell per run of matching cells above and below
+            for (int next = y - 1; next <= y + 1; next += 2)
+            {
+                if (next < 0 || next >= height)
+                    continue;
+
+                const UInt16 *nextRow = cells + next * width;
+                const UInt8 *nextDone = visited.constData() + next * width;
+                bool inRun = false;
+                for (int x = spanLeft; x <= spanRight; x++)
+                {
+                    const bool match = (!nextDone[x] && AME_MF_Key(nextRow[x], permissions) == key);
+                    if (match && !inRun)
+                        seeds.push_back(qMakePair(x, next));
+
+                    inRun = match;
+                }
+            }
+        }
+
+        if (right < 0)
+            return QRect();
+
+        return QRect(QPoint(left, top), QPoint(right, bottom));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every pattern row is expanded to the map width as a pair
+    // of AND and OR masks, which turns writing the pattern into
+    // (cell & and) | or for every matched cell of a map row.
+    //
+    ///////////////////////////////////////////////////////////
+    QRect MapFill::replace(MapBlockGrid &grid, const QPoint &start, const QVector<MapBlock> &pattern,
+                           const QSize &patternSize, bool permissions, QVector<Int32> *changed)
+    {
+        const Int32 width = grid.width();
+        const Int32 height = grid.height();
+        if (!grid.contains(start.x(), start.y()) || patternSize.isEmpty() ||
+             pattern.size() < patternSize.width() * patternSize.height())
+            return QRect();
+
+        UInt16 *cells = grid.data();
+        const UInt16 key = AME_MF_Key(cells[start.x() + start.y() * width], permissions);
+
+        // Expands the pattern rows to the map width
+        QVector<UInt16> andLines(patternSize.height() * width);
+        QVector<UInt16> orLines(patternSize.height() * width);
+        for (int py = 0; py < patternSize.height(); py++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                const MapBlock &entry = pattern.at(py * patternSize.width() + AME_MF_Wrap(x - start.x(), patternSize.width()));
+                andLines[py * width + x] = AME_MF_Keep(entry);
+                orLines[py * width + x] = AME_MF_Apply(0, entry);
+            }
+        }
+
+        Int32 left = width, top = height, right = -1, bottom = -1;
+        for (int y = 0; y < height; y++)
+        {
+            UInt16 *row = cells + y * width;
+            const Int32 line = AME_MF_Wrap(y - start.y(), patternSize.height()) * width;
+            const UInt16 *andLine = andLines.constData() + line;
+            const UInt16 *orLine = orLines.constData() + line;
+            Int32 x = 0;
+
+        #ifdef AME_MF_SSE2
+            const __m128i keys = _mm_set1_epi16(static_cast<short>(key));
+            const __m128i blockMask = _mm_set1_epi16(MBG_BLOCK_MASK);
+            for (; x + 8 <= width; x += 8)
+            {
+                const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + x));
+                const __m128i field = (permissions) ? _mm_srli_epi16(value, MBG_PERM_SHIFT) : _mm_and_si128(value, blockMask);
+                const __m128i match = _mm_cmpeq_epi16(field, keys);
+                if (_mm_movemask_epi8(match) == 0)
+                    continue;
+
+                // Writes the pattern to the matched cells only
+                const __m128i written = _mm_or_si128(
+                            _mm_and_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(andLine + x))),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(orLine + x)));
+                const __m128i result = _mm_or_si128(_mm_and_si128(match, written), _mm_andnot_si128(match, value));
+                const Int32 differs = _mm_movemask_epi8(_mm_cmpeq_epi16(result, value)) ^ 0xFFFF;
+                if (differs == 0)
+                    continue;
+
+                // Every cell owns two bits of the mask; only the lower one is kept
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(row + x), result);
+                quint32 bits = static_cast<quint32>(differs) & 0x5555;
+                left = qMin(left, x + static_cast<Int32>(qCountTrailingZeroBits(bits) / 2));
+                right = qMax(right, x + static_cast<Int32>((31 - qCountLeadingZeroBits(bits)) / 2));
+                top = qMin(top, y);
+                bottom = y;
+
+                while (changed != NULL && bits != 0)
+                {
+                    changed->push_back(x + qCountTrailingZeroBits(bits) / 2 + y * width);
+                    bits &= bits - 1;
+                }
+            }
+        #endif
+
+            // Handles the remaining cells one by one
+            for (; x < width; x++)
+            {
+                if (AME_MF_Key(row[x], permissions) != key)
+                    continue;
+
+                const UInt16 cell = (row[x] & andLine[x]) | orLine[x];
+                if (cell == row[x])
+                    continue;
+
+                row[x] = cell;
+                left = qMin(left, x);
+                right = qMax(right, x);
+                top = qMin(top, y);
+                bottom = y;
+                if (changed != NULL)
+                    changed->push_back(x + y * width);
+            }
+        }
+
+        if (right < 0)
+            return QRect();
+
+        return QRect(QPoint(left, top), QPoint(right, bottom));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Static
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    FillBenchmark MapFill::benchmark(const MapBlockGrid &grid, Int32 rounds)
+    {
+        FillBenchmark result;
+        result.cells = grid.size();
+        result.matches = 0;
+        result.referenceSpeed = 0.0;
+        result.replaceSpeed = 0.0;
+        result.identical = true;
+        if (grid.size() == 0)
+            return result;
+
+        // Replaces the top-left block with four other blocks
+        const UInt16 key = grid.block(0, 0);
+        QVector<MapBlock> pattern;
+        for (int i = 0; i < 4; i++)
+        {
+            MapBlock entry;
+            entry.block = (key + i + 1) & MBG_BLOCK_MASK;
+            entry.permission = -1;
+            pattern.push_back(entry);
+        }
+
+        const QSize patternSize(2, 2);
+        MapBlockGrid reference;
+        MapBlockGrid replaced;
+        QElapsedTimer timer;
+        qint64 referenceTime = 0;
+        qint64 replaceTime = 0;
+
+        for (int r = 0; r < rounds; r++)
+        {
+            // Detaches the copies before measuring
+            reference = grid;
+            reference.data();
+            timer.start();
+            for (int y = 0; y < reference.height(); y++)
+            {
+                for (int x = 0; x < reference.width(); x++)
+                {
+                    if (reference.block(x, y) == key)
+                        reference.setBlock(x, y, pattern.at((y % 2) * 2 + (x % 2)).block);
+                }
+            }
+            referenceTime += timer.nsecsElapsed();
+
+            replaced = grid;
+            replaced.data();
+            QVector<Int32> changed;
+            timer.start();
+            replace(replaced, QPoint(0, 0), pattern, patternSize, false, &changed);
+            replaceTime += timer.nsecsElapsed();
+            result.matches = changed.size();
+        }
+
+        result.identical = (reference.rawData() == replaced.rawData());
+
+        // Converts cells per nanosecond to million cells per second
+        const double total = (double)result.cells * rounds * 1000.0;
+        if (referenceTime > 0)
+            result.referenceSpeed = total / referenceTime;
+        if (replaceTime > 0)
+            result.replaceSpeed = total / replaceTime;
+
+        return result;
+    }
+}
@@ -39,6 +39,7 @@
 #include <AME/Mapping/MappingErrors.hpp>
 #include <AME/Mapping/MapHeader.hpp>
 #include <AME/Graphics/TilesetManager.hpp>
+#include <AME/System/Tracer.hpp>
 #include <QSize>
 
 
@@ -46,9 +47,9 @@ namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/11/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapHeader::MapHeader()
@@ -59,15 +60,18 @@ namespace ame
           m_PtrBlocks(0),
           m_PtrBorder(0),
           m_PtrPrimary(0),
-          m_PtrSecondary(0)
+          m_PtrSecondary(0),
+          m_Primary(NULL),
+          m_Secondary(NULL),
+          m_IsModified(false)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/11/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapHeader::MapHeader(const MapHeader &rvalue)
@@ -76,20 +80,23 @@ namespace ame
           m_Width(rvalue.m_Width),
           m_Height(rvalue.m_Height),
           m_PtrBlocks(rvalue.m_PtrBlocks),
-          m_PtrBorder(rvalue.m_PtrBlocks),
+          m_PtrBorder(rvalue.m_PtrBorder),
           m_PtrPrimary(rvalue.m_PtrPrimary),
           m_PtrSecondary(rvalue.m_PtrSecondary),
           m_Blocks(rvalue.m_Blocks),
           m_Primary(rvalue.m_Primary),
-          m_Secondary(rvalue.m_Secondary)
+          m_Secondary(rvalue.m_Secondary),
+          m_IsModified(rvalue.m_IsModified)
     {
+        TilesetManager::acquire(m_Primary);
+        TilesetManager::acquire(m_Secondary);
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/11/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapHeader &MapHeader::operator=(const MapHeader &rvalue)
@@ -98,9 +105,17 @@ namespace ame
         m_Width = rvalue.m_Width;
         m_Height = rvalue.m_Height;
         m_PtrBlocks = rvalue.m_PtrBlocks;
-        m_PtrBorder = rvalue.m_PtrBlocks;
+        m_PtrBorder = rvalue.m_PtrBorder;
         m_PtrPrimary = rvalue.m_PtrPrimary;
         m_PtrSecondary = rvalue.m_PtrSecondary;
+        m_IsModified = rvalue.m_IsModified;
+        // Acquires the new tilesets before releasing the old ones,
+        // in case both headers share the same tilesets
+        TilesetManager::acquire(rvalue.m_Primary);
+        TilesetManager::acquire(rvalue.m_Secondary);
+        TilesetManager::release(m_Primary);
+        TilesetManager::release(m_Secondary);
+
         m_Primary = rvalue.m_Primary;
         m_Secondary = rvalue.m_Secondary;
         return *this;
@@ -108,15 +123,15 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Destructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/11/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     MapHeader::~MapHeader()
     {
-        foreach (MapBlock *block, m_Blocks)
-            delete block;
+        TilesetManager::release(m_Primary);
+        TilesetManager::release(m_Secondary);
     }
 
 
@@ -127,8 +142,10 @@ namespace ame
     // Date of edit:   6/11/2016
     //
     ///////////////////////////////////////////////////////////
-    bool MapHeader::read(const qboy::Rom &rom, UInt32 offset)
+    bool MapHeader::read(const RomCursor &rom, UInt32 offset)
     {
+        AME_TRACE("layout", QString("Layout 0x%1").arg(offset, 0, 16));
+
         if (!rom.seek(offset))
             AME_THROW(HDR_ERROR_OFFSET, rom.redirected());
 
@@ -165,30 +182,28 @@ namespace ame
             m_Border.read(rom, m_PtrBorder, QSize(2, 2));
         }
 
-        // Retrieves the map block data
-        rom.seek(m_PtrBlocks);
-        for (unsigned i = 0; i < m_Width * m_Height; i++)
-        {
-            MapBlock *block = new MapBlock;
-            UInt16 data = rom.readHWord();
-
-            block->block = (data & 0x3FF);
-            block->permission = (data >> 0xA);
-            m_Blocks.push_back(block);
-        }
+        // Retrieves the map block data in one go
+        if (!m_Blocks.read(rom, m_PtrBlocks, m_Width, m_Height))
+            AME_THROW(HDR_ERROR_BLOCKS, offset + 12);
 
         // Loads the tilesets, if necessary
         if ((m_Primary = TilesetManager::get(m_PtrPrimary)) == NULL)
         {
-            m_Primary = new Tileset;
-            m_Primary->read(rom, m_PtrPrimary);
-            TilesetManager::add(m_Primary);
+            Tileset *tileset = new Tileset;
+            tileset->read(rom, m_PtrPrimary);
+
+            // Another thread might have loaded it meanwhile
+            if ((m_Primary = TilesetManager::add(tileset)) != tileset)
+                delete tileset;
         }
         if ((m_Secondary = TilesetManager::get(m_PtrSecondary)) == NULL)
         {
-            m_Secondary = new Tileset;
-            m_Secondary->read(rom, m_PtrSecondary);
-            TilesetManager::add(m_Secondary);
+            Tileset *tileset = new Tileset;
+            tileset->read(rom, m_PtrSecondary);
+
+            // Another thread might have loaded it meanwhile
+            if ((m_Secondary = TilesetManager::add(tileset)) != tileset)
+                delete tileset;
         }
 
 
@@ -198,6 +213,48 @@ namespace ame
     }
 
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<WriteEntry> MapHeader::write() const
+    {
+        WriteEntry entry(m_PtrBlocks);
+        entry.data = m_Blocks.rawData();
+
+        QList<WriteEntry> entries;
+        entries.push_back(entry);
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapHeader::isModified() const
+    {
+        return m_IsModified;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void MapHeader::setModified(bool modified)
+    {
+        m_IsModified = modified;
+    }
+
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributors:   Pokedude
@@ -217,23 +274,41 @@ namespace ame
     // Date of edit:   6/11/2016
     //
     ///////////////////////////////////////////////////////////
-    const QList<MapBlock *> &MapHeader::blocks() const
+    const MapBlockGrid &MapHeader::blocks() const
     {
         return m_Blocks;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
-    // Contributors:   Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   11/9/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    MapBlock *MapHeader::getBlock(int x, int y)
+    MapBlockGrid &MapHeader::blocks()
     {
-        if (x < 0 || x >= m_Width || y < 0 || y >= m_Height)
-            return NULL;
-        return m_Blocks[x + (m_Width * y)];
+        return m_Blocks;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapBlock MapHeader::getBlock(int x, int y) const
+    {
+        if (!m_Blocks.contains(x, y))
+        {
+            MapBlock invalid;
+            invalid.block = -1;
+            invalid.permission = -1;
+            return invalid;
+        }
+
+        return m_Blocks.at(x, y);
     }
 
     ///////////////////////////////////////////////////////////
@@ -243,7 +318,7 @@ namespace ame
     // Date of edit:   11/9/2016
     //
     ///////////////////////////////////////////////////////////
-    MapBlock *MapHeader::getBlock(QPoint pos)
+    MapBlock MapHeader::getBlock(QPoint pos) const
     {
         return this->getBlock(pos.x(), pos.y());
     }
@@ -284,6 +359,18 @@ namespace ame
         return m_PtrSecondary;
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 MapHeader::ptrBlocks() const
+    {
+        return m_PtrBlocks;
+    }
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributors:   Pokedude
@@ -38,10 +38,20 @@
 #include <AME/System/Configuration.hpp>
 #include <AME/Mapping/MappingErrors.hpp>
 #include <AME/Mapping/MapLayoutTable.hpp>
+#include <AME/Mapping/LayoutManager.hpp>
+#include <QtConcurrent/QtConcurrentRun>
 
 
 namespace ame
 {
+    ///////////////////////////////////////////////////////////
+    // Local definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define LAY_PRIMARY     16  // Tileset pointers within a layout
+    #define LAY_SECONDARY   20
+
+
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
     // Contributors:   Pokedude, Diegoisawesome
@@ -52,7 +62,8 @@ namespace ame
     MapLayoutTable::MapLayoutTable()
         : /*IUndoable(),*/
           m_Offset(0),
-          m_Count(-1)
+          m_Count(-1),
+          m_Data(NULL)
     {
     }
 
@@ -66,7 +77,8 @@ namespace ame
     MapLayoutTable::MapLayoutTable(const MapLayoutTable &rvalue)
         : /*IUndoable(),*/
           m_Offset(rvalue.m_Offset),
-          m_Count(rvalue.m_Count)
+          m_Count(rvalue.m_Count),
+          m_Data(rvalue.m_Data)
     {
     }
 
@@ -81,31 +93,36 @@ namespace ame
     {
         m_Offset = rvalue.m_Offset;
         m_Count = rvalue.m_Count;
+        m_Data = rvalue.m_Data;
         return *this;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Destructor
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   7/3/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Layouts are owned by LayoutManager; only the placeholders
+    // for null entries belong to the table.
     //
     ///////////////////////////////////////////////////////////
     MapLayoutTable::~MapLayoutTable()
     {
-        foreach (MapHeader *mapHeader, m_MapHeaders)
+        foreach (MapHeader *mapHeader, m_EmptyHeaders)
             delete mapHeader;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   7/3/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool MapLayoutTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool MapLayoutTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(LAY_ERROR_OFFSET, rom.redirected());
@@ -159,31 +176,107 @@ namespace ame
         }
 
 
-        // Now attempts to read all the maps
+        // Now attempts to read all the maps, concurrently; the
+        // layouts are shared with the maps through LayoutManager
+        QList<QFuture<MapHeader *>> tasks;
         for (int i = 0; i < m_Count; i++)
         {
             rom.seek(offset + i * 4);
 
             // Retrieves the pointer to the map
-            MapHeader *mapHeader = new MapHeader;
             UInt32 mapOff = rom.readPointerRef();
+            m_Layouts.push_back(mapOff);
 
             // Attempts to read the map layout
-            if (mapOff != 0 && !mapHeader->read(rom, mapOff))
-            {
-                delete mapHeader;
-                return false;
-            }
+            tasks.push_back(QtConcurrent::run([rom, mapOff]() {
+                if (mapOff == 0)
+                    return new MapHeader;
+                else
+                    return LayoutManager::load(rom, mapOff);
+            }));
+        }
+
+        // Collects the layouts; empty entries are owned by the table
+        bool result = true;
+        foreach (QFuture<MapHeader *> task, tasks)
+        {
+            MapHeader *mapHeader = task.result();
+            if (mapHeader == NULL)
+                result = false;
+            else if (mapHeader->offset() == 0)
+                m_EmptyHeaders.push_back(mapHeader);
 
             m_MapHeaders.push_back(mapHeader);
         }
 
+        if (!result)
+            return false;
+
 
         // Loading successful
         m_Offset = offset;
+        m_Data = &rom.data();
         return true;
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Does not read any layout; they are loaded on first use,
+    // which keeps a cache hit independent of the layout count.
+    //
+    ///////////////////////////////////////////////////////////
+    bool MapLayoutTable::restore(const RomCursor &rom, UInt32 offset, const UInt32 *layouts, UInt32 count)
+    {
+        m_Layouts.clear();
+        m_MapHeaders.clear();
+        for (UInt32 i = 0; i < count; i++)
+        {
+            m_Layouts.push_back(layouts[i]);
+            m_MapHeaders.push_back(NULL);
+        }
+
+
+        // Loading successful
+        m_Offset = offset;
+        m_Count = count;
+        m_Data = &rom.data();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The index was built from this very ROM, thus the layout
+    // is known to be valid; should it fail anyways, an empty
+    // placeholder keeps the list free of null entries.
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *MapLayoutTable::load(Int32 index) const
+    {
+        const UInt32 mapOff = m_Layouts.at(index);
+
+        MapHeader *mapHeader = NULL;
+        if (mapOff != 0)
+            mapHeader = LayoutManager::load(RomCursor(*m_Data), mapOff);
+
+        if (mapHeader == NULL)
+        {
+            mapHeader = new MapHeader;
+            m_EmptyHeaders.push_back(mapHeader);
+        }
+
+        return mapHeader;
+    }
+
 
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
@@ -206,9 +299,99 @@ namespace ame
     ///////////////////////////////////////////////////////////
     const QList<MapHeader *> &MapLayoutTable::mapHeaders() const
     {
+        // Loads all the layouts that were not used so far
+        QList<QFuture<MapHeader *>> tasks;
+        QList<Int32> indices;
+        for (int i = 0; i < m_MapHeaders.size(); i++)
+        {
+            if (m_MapHeaders.at(i) != NULL || m_Layouts.at(i) == 0)
+                continue;
+
+            const UInt32 mapOff = m_Layouts.at(i);
+            const RomData *data = m_Data;
+            tasks.push_back(QtConcurrent::run([data, mapOff]() {
+                return LayoutManager::load(RomCursor(*data), mapOff);
+            }));
+
+            indices.push_back(i);
+        }
+
+        for (int i = 0; i < tasks.size(); i++)
+            m_MapHeaders[indices.at(i)] = tasks[i].result();
+
+        // Empty entries and failed layouts get placeholders
+        for (int i = 0; i < m_MapHeaders.size(); i++)
+            if (m_MapHeaders.at(i) == NULL)
+                m_MapHeaders[i] = load(i);
+
         return m_MapHeaders;
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *MapLayoutTable::mapHeader(Int32 index) const
+    {
+        if (m_MapHeaders.at(index) == NULL)
+            m_MapHeaders[index] = load(index);
+
+        return m_MapHeaders.at(index);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 MapLayoutTable::layoutOffset(Int32 index) const
+    {
+        return m_Layouts.at(index);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Reads the pointer directly, without loading the layout.
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 MapLayoutTable::primaryOffset(Int32 index) const
+    {
+        const UInt32 mapOff = m_Layouts.at(index);
+        if (mapOff == 0 || !m_Data->canRead(mapOff + LAY_PRIMARY, 4))
+            return 0;
+
+        return m_Data->readPointer(mapOff + LAY_PRIMARY);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Reads the pointer directly, without loading the layout.
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 MapLayoutTable::secondaryOffset(Int32 index) const
+    {
+        const UInt32 mapOff = m_Layouts.at(index);
+        if (mapOff == 0 || !m_Data->canRead(mapOff + LAY_SECONDARY, 4))
+            return 0;
+
+        return m_Data->readPointer(mapOff + LAY_SECONDARY);
+    }
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributors:   Diegoisawesome
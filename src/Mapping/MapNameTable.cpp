@@ -98,16 +98,30 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   7/1/2016
+    // Contributors:   Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool MapNameTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool MapNameTable::read(const RomCursor &rom, UInt32 offset, const QStringList *names)
     {
         if (!rom.seek(offset))
             AME_THROW(MBT_ERROR_OFFSET, rom.redirected());
 
+        // Takes the names from the index, if available
+        if (names != NULL)
+        {
+            foreach (const QString &string, *names)
+            {
+                MapName *name = new MapName();
+                name->name = string;
+                m_Names.push_back(name);
+            }
+
+            m_Offset = offset;
+            return true;
+        }
+
         // Reads all the name index info
         for (int i = 0; i < (int)CONFIG(MapNameCount); i++)
         {
@@ -94,17 +94,24 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   7/5/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool ItemTable::read(const qboy::Rom &rom)
+    bool ItemTable::read(const RomCursor &rom, const QStringList *names)
     {
         // Checks the configuration pointer
         if (!rom.checkOffset(CONFIG(ItemData)))
             AME_THROW2(ITM_ERROR_DATA);
 
+        // Takes the names from the index, if available
+        if (names != NULL)
+        {
+            m_Names = *names;
+            return true;
+        }
+
         // Attempts to read all the item names
         for (unsigned i = 0; i < CONFIG(ItemCount); i++)
         {
@@ -39,6 +39,8 @@
 #include <AME/Structures/StructureErrors.hpp>
 #include <AME/Structures/PokemonTable.hpp>
 #include <AME/System/Configuration.hpp>
+#include <AME/Graphics/GbaGraphics.hpp>
+#include <cstring>
 
 
 namespace ame
@@ -97,12 +99,12 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/19/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool PokemonTable::read(const qboy::Rom &rom)
+    bool PokemonTable::read(const RomCursor &rom, const QStringList *names)
     {
         // Checks all the configuration pointers
         if (!rom.checkOffset(CONFIG(PokemonNames)))
@@ -127,11 +129,13 @@ namespace ame
 
             m_Images.push_back(QImage(32, 32, QImage::Format_Indexed8));
             QImage &current = m_Images[i];
-            qboy::Image image;
+            QByteArray image;
+
+            // Decodes the image; 32 pixels wide lines need no padding
+            if (!GbaGraphics::readImage(rom.data(), ptrImage, 32, 32, image))
+                AME_THROW(PKM_ERROR_IMAGE, rom.redirected());
 
-            // Decodes the image
-            image.readUncompressed(rom, ptrImage, 512, 32, true);
-            memcpy(current.bits(), image.raw().data(), 1024);
+            memcpy(current.bits(), image.constData(), 1024);
         }
 
 
@@ -139,19 +143,13 @@ namespace ame
         QList<QVector<QRgb>> colorTables;
         for (int i = 0; i < 3; i++)
         {
-            qboy::Palette palette;
-            palette.readUncompressed(rom, CONFIG(PokemonPals) + i * 32, 16);
-            colorTables.push_back(QVector<QRgb>());
-
-            // Converts the palette to a color table
-            for (int j = 0; j < 16; j++)
-            {
-                const qboy::Color &color = palette.raw().at(j);
-                if (j == 0)
-                    colorTables[i].push_back(QColor::fromRgb(0, 0, 0, 0).rgba());
-                else
-                    colorTables[i].push_back(QColor::fromRgb(color.r, color.g, color.b).rgb());
-            }
+            QVector<QRgb> palette;
+            if (!GbaGraphics::readPalette(rom.data(), CONFIG(PokemonPals) + i * 32, palette))
+                AME_THROW2(PKM_ERROR_PALS);
+
+            // The first color of the color table is transparent
+            palette[0] = qRgba(0, 0, 0, 0);
+            colorTables.push_back(palette);
         }
 
 
@@ -172,7 +170,13 @@ namespace ame
         }
 
 
-        // Attempts to read all the pokemon names
+        // Attempts to read all the pokemon names, unless indexed
+        if (names != NULL)
+        {
+            m_Names = *names;
+            return true;
+        }
+
         for (unsigned i = 0; i < CONFIG(PokemonCount); i++)
         {
             m_Names.push_back(String::read(rom, CONFIG(PokemonNames) + i * 11));
@@ -112,7 +112,7 @@ namespace ame
     // Date of edit:   6/4/2016
     //
     ///////////////////////////////////////////////////////////
-    bool WildPokemonArea::read(const qboy::Rom &rom, UInt32 offset, UInt32 amount)
+    bool WildPokemonArea::read(const RomCursor &rom, UInt32 offset, UInt32 amount)
     {
         rom.seek(offset); // exception-safe this time
 
@@ -144,12 +144,12 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> WildPokemonArea::write(UInt32 offset)
+    QList<WriteEntry> WildPokemonArea::write(UInt32 offset) const
     {
         QList<WriteEntry> entries;
         WriteEntry tableEntry;
@@ -104,7 +104,7 @@ namespace ame
     // Date of edit:   6/3/2016
     //
     ///////////////////////////////////////////////////////////
-    bool WildPokemonSubTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool WildPokemonSubTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(WPST_ERROR_OFFSET, rom.redirected());
@@ -163,16 +163,16 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> WildPokemonSubTable::write()
+    QList<WriteEntry> WildPokemonSubTable::write(UInt32 offset) const
     {
         QList<WriteEntry> entries;
         WriteEntry entry;
-        entry.offset = m_Offset;
+        entry.offset = (offset > 0) ? offset : m_Offset;
 
 
         // Adds bank, map and all the pointers to the entry
@@ -231,6 +231,18 @@ namespace ame
         return m_Offset;
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void WildPokemonSubTable::setOffset(UInt32 offset)
+    {
+        m_Offset = offset;
+    }
+
     ///////////////////////////////////////////////////////////
     // Function type:  Getter
     // Contributors:   Pokedude
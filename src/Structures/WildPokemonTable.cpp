@@ -43,38 +43,40 @@ namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     WildPokemonTable::WildPokemonTable()
         : IUndoable(),
           m_Offset(0),
-          m_Count(0)
+          m_Count(0),
+          m_IsModified(false)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     WildPokemonTable::WildPokemonTable(const WildPokemonTable &rvalue)
         : IUndoable(),
           m_Offset(rvalue.m_Offset),
           m_Count(rvalue.m_Count),
-          m_Tables(rvalue.m_Tables)
+          m_Tables(rvalue.m_Tables),
+          m_IsModified(rvalue.m_IsModified)
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     WildPokemonTable &WildPokemonTable::operator=(const WildPokemonTable &rvalue)
@@ -82,6 +84,7 @@ namespace ame
         m_Offset = rvalue.m_Offset;
         m_Count = rvalue.m_Count;
         m_Tables = rvalue.m_Tables;
+        m_IsModified = rvalue.m_IsModified;
         return *this;
     }
 
@@ -112,7 +115,7 @@ namespace ame
     // Date of edit:   6/3/2016
     //
     ///////////////////////////////////////////////////////////
-    bool WildPokemonTable::read(const qboy::Rom &rom, UInt32 offset)
+    bool WildPokemonTable::read(const RomCursor &rom, UInt32 offset)
     {
         if (!rom.seek(offset))
             AME_THROW(WPT_ERROR_OFFSET, rom.redirected());
@@ -150,92 +153,158 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool WildPokemonTable::requiresRepoint(const qboy::Rom &rom)
+    bool WildPokemonTable::requiresRepoint(const FreespaceIndex &freespace) const
     {
-        if (m_Tables.size() < m_Count)
+        if (m_Tables.size() <= m_Count)
             return false;
 
-        // Seeks to the end of the current table
-        rom.seek(m_Offset + m_Count * 20);
-
-        // Now determines whether there is enough trailing free space
-        for (int i = 0; i < m_Tables.size() - m_Count; i++)
-        {
-            if (!rom.canRead(VT_Word))
-                return true;
-            if (rom.readWord() != 0xFFFFFFFF)
-                return true;
-        }
-
-        // Iteration survived; enough space
-        return false;
+        // The table grows into the space after its ending sequence
+        const UInt32 end = m_Offset + (m_Count + 1) * 20;
+        return !freespace.isFree(end, (m_Tables.size() - m_Count) * 20);
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     // Comment:
     //
-    // Added the ending sequence (0x0000FFFF) to the entries.
+    // The sub-tables are stored inline, 20 bytes each, and are
+    // terminated by an entry starting with 0x0000FFFF; they
+    // are not referenced by pointers.
     //
     ///////////////////////////////////////////////////////////
-    QList<WriteEntry> WildPokemonTable::write(UInt32 offset)
+    QList<WriteEntry> WildPokemonTable::write(UInt32 offset) const
     {
         QList<WriteEntry> entries;
+        const UInt32 oldSize = (m_Count + 1) * 20;
+        const UInt32 newSize = dataSize();
+        const UInt32 target = (offset > 0) ? offset : m_Offset;
 
 
         // If offset is a repointed offset, clear old data with 0xFF
         if (offset > 0)
         {
-            // Each pointer is sized four bytes
             WriteEntry clearEntry { m_Offset };
-            for (int i = 0; i < m_Count * 4; i++)
-                clearEntry.data.push_back(0xFF);
-
+            clearEntry.data.fill((char)0xFF, oldSize);
             entries.push_back(clearEntry);
+        }
+
+        // If table is smaller than before, clear unused space
+        else if (newSize < oldSize)
+        {
+            WriteEntry clearEntry { m_Offset + newSize };
+            clearEntry.data.fill((char)0xFF, oldSize - newSize);
+            entries.append(clearEntry);
+        }
+
+
+        // Writes all sub-tables along with their encounters
+        for (int i = 0; i < m_Tables.size(); i++)
+            entries.append(m_Tables[i]->write(target + i * 20));
+
+        // Appends the ending sequence as one entry
+        WriteEntry endEntry { target + m_Tables.size() * 20 };
+        endEntry.addWord(0x0000FFFF);
+        endEntry.data.append(QByteArray(16, '\0'));
+        entries.append(endEntry);
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void WildPokemonTable::commit(FreespaceIndex &freespace, UInt32 offset)
+    {
+        const UInt32 oldSize = (m_Count + 1) * 20;
+        const UInt32 newSize = dataSize();
+
+        // The new location was reserved before writing
+        if (offset > 0)
+        {
+            freespace.free(m_Offset, oldSize);
 
             // Adds an undo entry for the repoint
             UndoEntry repEntry;
+            repEntry.table = NULL;
             repEntry.action = URA_ACTION_REPOINT;
             repEntry.offset = m_Offset;
             s_UndoStack.append(repEntry);
 
-            // Sets the repointed offset as new offset
             m_Offset = offset;
         }
-
-        // If table is smaller than before, clear unused space
-        if (m_Tables.size() < m_Count)
+        else if (newSize < oldSize)
         {
-            WriteEntry clearEntry { m_Offset + m_Tables.size() * 4 };
-            for (int i = 0; i < m_Count - m_Tables.size(); i++)
-                clearEntry.data.push_back((char)0xFF);
-
-            entries.append(clearEntry);
+            freespace.free(m_Offset + newSize, oldSize - newSize);
         }
-
-
-        // Writes all the pointers to the table
-        WriteEntry tableEntry { m_Offset };
-        for (int i = 0; i < m_Tables.size(); i++)
+        else if (newSize > oldSize)
         {
-            WildPokemonSubTable *sub = m_Tables[i];
-            tableEntry.addPointer(sub->offset());
-            entries.append(sub->write());
+            freespace.claim(m_Offset + oldSize, newSize - oldSize);
         }
 
+        // The written table is the new initial table
+        for (int i = 0; i < m_Tables.size(); i++)
+            m_Tables[i]->setOffset(m_Offset + i * 20);
 
-        // Appends all table pointers as one entry
-        tableEntry.addWord(0x0000FFFF);
-        entries.append(tableEntry);
-        return entries;
+        m_Count = m_Tables.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 WildPokemonTable::offset() const
+    {
+        return m_Offset;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 WildPokemonTable::dataSize() const
+    {
+        return (m_Tables.size() + 1) * 20;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool WildPokemonTable::isModified() const
+    {
+        return m_IsModified;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void WildPokemonTable::setModified(bool modified)
+    {
+        m_IsModified = modified;
     }
 
 
@@ -253,9 +322,9 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/4/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     // Comment:
     //
     // Fixed the index; previously took s_UndoStack.size.
@@ -272,13 +341,15 @@ namespace ame
 
         // Now adds the sub-table to the actual head table
         m_Tables.append(subTable);
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void WildPokemonTable::remove(Int32 index)
@@ -292,14 +363,16 @@ namespace ame
 
         // Now removes the table at the given index
         m_Tables.removeAt(index);
+
+        m_IsModified = true;
     }
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void WildPokemonTable::undo()
@@ -330,13 +403,15 @@ namespace ame
             entry.offset = newOffset;
             s_RedoStack.append(entry);
         }
+
+        m_IsModified = true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Virtual
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/3/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void WildPokemonTable::redo()
@@ -367,5 +442,7 @@ namespace ame
             entry.offset = oldOffset;
             s_UndoStack.append(entry);
         }
+
+        m_IsModified = true;
     }
 }
@@ -38,7 +38,7 @@
 #include <AME/System/Configuration.hpp>
 #include <AME/System/ErrorStack.hpp>
 #include <yaml-cpp/yaml.h>
-#include <QApplication>
+#include <QCoreApplication>
 #include <QFileInfo>
 #include <QFile>
 
@@ -58,6 +58,7 @@ namespace ame
     UInt32 Configuration::PokemonUsage;
     UInt32 Configuration::PokemonPals;
     UInt32 Configuration::WildPokemon;
+    UInt32 Configuration::WildPokemonRef;
     UInt32 Configuration::ItemData;
     UInt32 Configuration::ItemCount;
     UInt32 Configuration::Overworlds;
@@ -85,19 +86,16 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude, Nekaida
-    // Last edit by:   Nekaida
-    // Date of edit:   3/31/2017
+    // Contributors:   Pokedude, Nekaida, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool Configuration::parse(const qboy::Rom &rom)
+    bool Configuration::parse(const RomCursor &rom)
     {
         // Builds the path to the YAML file for this ROM
-        const QString appFolder = QApplication::applicationDirPath();
-        const QString subFolder = "/config/";
-        const QString fileName = rom.info().code();
-        const QString fileExt = ".yaml";
-        QString filePath = appFolder + subFolder + fileName + fileExt;
+        const QString fileName = rom.data().code();
+        const QString filePath = Configuration::filePath(fileName);
 
         // Loads the YAML file
         YAML::Node configNode;
@@ -154,6 +152,7 @@ namespace ame
         FETCH(PokemonIcons, rom.readPointer());
         FETCH(PokemonUsage, rom.readPointer());
         FETCH(PokemonPals, rom.readPointer());
+        WildPokemonRef = WildPokemon; // Keeps the location of the pointer for repointing
         FETCH(WildPokemon, rom.readPointer());
         FETCH(ItemData, rom.readPointer());
         FETCH(ItemCount, rom.readByte());
@@ -180,4 +179,31 @@ namespace ame
         // Parsing successful
         return true;
     }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString Configuration::filePath(const RomData &rom)
+    {
+        return filePath(rom.code());
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString Configuration::filePath(const QString &code)
+    {
+        const QString appFolder = QCoreApplication::applicationDirPath();
+        const QString subFolder = "/config/";
+        const QString fileExt = ".yaml";
+        return appFolder + subFolder + code + fileExt;
+    }
 }
@@ -37,6 +37,7 @@
 ///////////////////////////////////////////////////////////
 #include <AME/System/ErrorStack.hpp>
 #include <QDateTime>
+#include <QMutex>
 
 
 namespace ame
@@ -47,16 +48,18 @@ namespace ame
     ///////////////////////////////////////////////////////////
     QStringList s_Stack;
     QStringList s_Methods;
+    QMutex s_Mutex;
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/2/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     // Comment:
     //
-    // Added a conversion for template strings.
+    // Added a conversion for template strings. The stack is
+    // guarded by a mutex, as tables are loaded concurrently.
     //
     ///////////////////////////////////////////////////////////
     bool ErrorStack::add(QString method, QString error, UInt32 offset)
@@ -72,6 +75,7 @@ namespace ame
         method.remove(firstBrack, 69);
 
         // Copies the string to the stack
+        QMutexLocker lock(&s_Mutex);
         s_Stack.append(error);
         s_Methods.append(method);
 
@@ -167,13 +171,14 @@ namespace ame
 
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/16/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void ErrorStack::clear()
     {
+        QMutexLocker lock(&s_Mutex);
         s_Stack.clear();
         s_Methods.clear();
     }
@@ -0,0 +1,387 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/FreespaceIndex.hpp>
+#include <QtAlgorithms>
+#include <QVector>
+#include <QPair>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define AME_FSI_SSE2
+#endif
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Local definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define FSI_MIN_RUN     0x10    // Shorter runs are considered data
+    #define FSI_GUARD       0x4     // Bytes skipped at the start of a run
+    #define FSI_LANES       16
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Toggles the run state at every byte of the given lanes
+    // that differs from the current state; bit n of the mask
+    // is set if byte n is free.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_FSI_Runs(UInt32 mask, UInt32 lanes, UInt32 base, bool &inRun, UInt32 &runStart, QVector<QPair<UInt32, UInt32>> &runs)
+    {
+        const UInt32 all = (1u << lanes) - 1;
+        UInt32 bits = (inRun ? ~mask : mask) & all;
+        while (bits != 0)
+        {
+            const UInt32 bit = qCountTrailingZeroBits(bits);
+            if (inRun)
+                runs.push_back(qMakePair(runStart, base + bit));
+            else
+                runStart = base + bit;
+
+            inRun = !inRun;
+            bits = (inRun ? ~mask : mask) & all & ~((1u << bit) - 1);
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    FreespaceIndex::FreespaceIndex()
+        : m_Total(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Compares 16 bytes at once and only looks at single bytes
+    // where a run starts or ends, which is rare both in data
+    // and in free space.
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::build(const RomData &rom, UInt32 start)
+    {
+        clear();
+
+        const UInt8 *data = rom.data();
+        const UInt32 size = rom.size();
+        if (data == NULL || start >= size)
+            return;
+
+        QVector<QPair<UInt32, UInt32>> runs;
+        UInt32 runStart = start;
+        UInt32 pos = start;
+        bool inRun = false;
+
+    #ifdef AME_FSI_SSE2
+        const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+        for (; pos + FSI_LANES <= size; pos += FSI_LANES)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+            const UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, ones)));
+            if (mask != (inRun ? 0xFFFFu : 0u))
+                AME_FSI_Runs(mask, FSI_LANES, pos, inRun, runStart, runs);
+        }
+    #else
+        // Skips eight bytes at once while the state does not change
+        for (; pos + 8 <= size; pos += 8)
+        {
+            quint64 word;
+            std::memcpy(&word, data + pos, 8);
+
+            const quint64 inverse = ~word;
+            const bool anyFree = ((inverse - Q_UINT64_C(0x0101010101010101)) & word & Q_UINT64_C(0x8080808080808080)) != 0;
+            if (inRun ? (inverse == 0) : !anyFree)
+                continue;
+
+            UInt32 mask = 0;
+            for (int i = 0; i < 8; i++)
+                mask |= (data[pos + i] == 0xFF) << i;
+
+            AME_FSI_Runs(mask, 8, pos, inRun, runStart, runs);
+        }
+    #endif
+
+        // Processes the remaining bytes one by one
+        for (; pos < size; pos++)
+            AME_FSI_Runs(data[pos] == 0xFF, 1, pos, inRun, runStart, runs);
+
+        if (inRun)
+            runs.push_back(qMakePair(runStart, size));
+
+
+        // Drops runs that are most likely part of data
+        for (int i = 0; i < runs.size(); i++)
+        {
+            const UInt32 begin = (runs.at(i).first == start) ? start : runs.at(i).first + FSI_GUARD;
+            if (begin < runs.at(i).second && runs.at(i).second - begin >= FSI_MIN_RUN)
+                insert(begin, runs.at(i).second - begin);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::clear()
+    {
+        m_Ranges.clear();
+        m_Sizes.clear();
+        m_Total = 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::insert(UInt32 offset, UInt32 size)
+    {
+        m_Ranges.insert(offset, size);
+        m_Sizes.insert(size, offset);
+        m_Total += size;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::remove(UInt32 offset)
+    {
+        const UInt32 size = m_Ranges.take(offset);
+        m_Sizes.remove(size, offset);
+        m_Total -= size;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Whatever is left before and after the reserved bytes is
+    // put back as a range of its own.
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::carve(UInt32 range, UInt32 offset, UInt32 size)
+    {
+        const UInt32 end = range + m_Ranges.value(range);
+        remove(range);
+
+        if (offset > range)
+            insert(range, offset - range);
+        if (offset + size < end)
+            insert(offset + size, end - offset - size);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Ranges are visited by ascending size, so the first one
+    // that fits after aligning is the best fit.
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 FreespaceIndex::allocate(UInt32 size, UInt32 alignment)
+    {
+        if (size == 0 || alignment == 0)
+            return 0;
+
+        QMultiMap<UInt32, UInt32>::const_iterator it = m_Sizes.lowerBound(size);
+        for (; it != m_Sizes.constEnd(); ++it)
+        {
+            const UInt32 range = it.value();
+            const UInt32 offset = (range + alignment - 1) & ~(alignment - 1);
+            if (offset - range > it.key() - size)
+                continue;
+
+            carve(range, offset, size);
+            return offset;
+        }
+
+        return 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool FreespaceIndex::claim(UInt32 offset, UInt32 size)
+    {
+        if (size == 0 || !isFree(offset, size))
+            return false;
+
+        carve((--m_Ranges.upperBound(offset)).key(), offset, size);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Bytes that are already free are not counted twice; the
+    // new range absorbs every range it overlaps or touches.
+    //
+    ///////////////////////////////////////////////////////////
+    void FreespaceIndex::free(UInt32 offset, UInt32 size)
+    {
+        if (size == 0)
+            return;
+
+        UInt32 begin = offset;
+        UInt32 end = offset + size;
+
+        // Merges with the range before, if it reaches the new one
+        QMap<UInt32, UInt32>::iterator it = m_Ranges.upperBound(offset);
+        if (it != m_Ranges.begin())
+        {
+            --it;
+            if (it.key() + it.value() >= begin)
+            {
+                begin = it.key();
+                end = qMax(end, it.key() + it.value());
+                remove(begin);
+            }
+        }
+
+        // Merges with all ranges starting within or right after it
+        it = m_Ranges.lowerBound(begin);
+        while (it != m_Ranges.end() && it.key() <= end)
+        {
+            end = qMax(end, it.key() + it.value());
+            remove(it.key());
+            it = m_Ranges.lowerBound(begin);
+        }
+
+        insert(begin, end - begin);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool FreespaceIndex::isFree(UInt32 offset, UInt32 size) const
+    {
+        QMap<UInt32, UInt32>::const_iterator it = m_Ranges.upperBound(offset);
+        if (it == m_Ranges.constBegin())
+            return false;
+
+        --it;
+        return (offset + size <= it.key() + it.value());
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const QMap<UInt32, UInt32> &FreespaceIndex::ranges() const
+    {
+        return m_Ranges;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 FreespaceIndex::totalSize() const
+    {
+        return m_Total;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 FreespaceIndex::largestSize() const
+    {
+        return m_Sizes.isEmpty() ? 0 : (--m_Sizes.constEnd()).key();
+    }
+}
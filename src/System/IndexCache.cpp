@@ -0,0 +1,627 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/IndexCache.hpp>
+#include <AME/System/LoadedData.hpp>
+#include <QStandardPaths>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QVector>
+#include <QDir>
+#include <cstring>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Local definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define IDX_MAGIC       0x58444941  // "AIDX"
+    #define IDX_VERSION     2           // Increase on any layout change
+    #define IDX_PRIME1      0x9E3779B185EBCA87ULL
+    #define IDX_PRIME2      0xC2B2AE3D27D4EB4FULL
+    #define IDX_MAX_FILES   16          // Indices kept in the cache folder
+    #define IDX_MAX_AGE     30          // Days an unused index is kept
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline quint64 AME_IC_Mix(quint64 hash, quint64 lane)
+    {
+        lane *= IDX_PRIME2;
+        lane = (lane << 31) | (lane >> 33);
+        lane *= IDX_PRIME1;
+        hash ^= lane;
+        return ((hash << 27) | (hash >> 37)) * IDX_PRIME1 + 0x52DCE729;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_IC_Append(QByteArray &image, const void *data, quint64 size)
+    {
+        image.append(reinterpret_cast<const char *>(data), static_cast<int>(size));
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    /// \brief Leads the cache file and counts its records.
+    ///
+    /// The records follow in the order of the counts, without
+    /// any padding. Everything is stored in host byte order,
+    /// as the cache never leaves the machine.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct IndexHead
+    {
+        UInt32 magic;
+        UInt32 version;
+        quint64 key;
+        UInt32 banks;
+        UInt32 maps;
+        UInt32 layouts;
+        UInt32 wildLinks;
+        UInt32 mapNames;
+        UInt32 pokemonNames;
+        UInt32 itemNames;
+        UInt32 chars;
+    };
+
+    ///////////////////////////////////////////////////////////
+    /// \brief Locates a name within the UTF-16 characters.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct IndexString
+    {
+        UInt32 start;
+        UInt32 length;
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    IndexCache::IndexCache()
+        : m_Mapped(NULL),
+          m_Head(NULL),
+          m_Banks(NULL),
+          m_Maps(NULL),
+          m_Layouts(NULL),
+          m_WildLinks(NULL),
+          m_MapNames(NULL),
+          m_PokemonNames(NULL),
+          m_ItemNames(NULL),
+          m_Chars(NULL)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Destructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    IndexCache::~IndexCache()
+    {
+        if (m_Mapped != NULL)
+            m_File.unmap(m_Mapped);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Hashes a 32 MB ROM in a few milliseconds, which is far
+    // below the time it takes to parse it.
+    //
+    ///////////////////////////////////////////////////////////
+    quint64 IndexCache::hash(const UInt8 *data, UInt32 size, quint64 seed)
+    {
+        quint64 hash = seed ^ (size * IDX_PRIME1);
+        UInt32 pos = 0;
+
+        // Processes eight bytes at once
+        for (; pos + 8 <= size; pos += 8)
+        {
+            quint64 lane;
+            std::memcpy(&lane, data + pos, 8);
+            hash = AME_IC_Mix(hash, lane);
+        }
+
+        // Processes the remaining bytes as one lane
+        if (pos < size)
+        {
+            quint64 lane = 0;
+            for (UInt32 i = 0; pos + i < size; i++)
+                lane |= static_cast<quint64>(data[pos + i]) << (i * 8);
+
+            hash = AME_IC_Mix(hash, lane);
+        }
+
+        // Distributes the bits of the last lanes
+        hash ^= hash >> 33;
+        hash *= IDX_PRIME2;
+        hash ^= hash >> 29;
+        hash *= IDX_PRIME1;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString IndexCache::filePath(quint64 key)
+    {
+        const QString folder = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/";
+        return folder + QString("%1.idx").arg(key, 16, 16, QChar('0'));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Every modified ROM produces a new key, so the indices of
+    // previous states would otherwise pile up forever.
+    //
+    ///////////////////////////////////////////////////////////
+    void IndexCache::evict(const QString &folder)
+    {
+        const QFileInfoList files = QDir(folder).entryInfoList(
+                    QStringList() << "*.idx", QDir::Files, QDir::Time);
+
+        const QDateTime limit = QDateTime::currentDateTime().addDays(-IDX_MAX_AGE);
+        for (int i = 0; i < files.size(); i++)
+        {
+            if (i >= IDX_MAX_FILES || files.at(i).lastModified() < limit)
+                QFile::remove(files.at(i).absoluteFilePath());
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The counts are checked against the size of the image
+    // before any record is located; the bank and name records
+    // are checked against the arrays they refer to.
+    //
+    ///////////////////////////////////////////////////////////
+    bool IndexCache::attach(const uchar *data, quint64 size)
+    {
+        m_Head = NULL;
+        if (size < sizeof(IndexHead))
+            return false;
+
+        const IndexHead *head = reinterpret_cast<const IndexHead *>(data);
+        if (head->magic != IDX_MAGIC || head->version != IDX_VERSION)
+            return false;
+
+        const quint64 strings = static_cast<quint64>(head->mapNames) + head->pokemonNames + head->itemNames;
+        const quint64 total = sizeof(IndexHead)
+                + static_cast<quint64>(head->banks) * sizeof(IndexBank)
+                + (static_cast<quint64>(head->maps) + head->layouts) * sizeof(UInt32)
+                + static_cast<quint64>(head->wildLinks) * sizeof(IndexWildLink)
+                + strings * sizeof(IndexString)
+                + static_cast<quint64>(head->chars) * sizeof(UInt16);
+
+        if (total != size)
+            return false;
+
+
+        // Locates the records one after another
+        const uchar *pos = data + sizeof(IndexHead);
+        m_Banks = reinterpret_cast<const IndexBank *>(pos);
+        pos += head->banks * sizeof(IndexBank);
+        m_Maps = reinterpret_cast<const UInt32 *>(pos);
+        pos += head->maps * sizeof(UInt32);
+        m_Layouts = reinterpret_cast<const UInt32 *>(pos);
+        pos += head->layouts * sizeof(UInt32);
+        m_WildLinks = reinterpret_cast<const IndexWildLink *>(pos);
+        pos += head->wildLinks * sizeof(IndexWildLink);
+        m_MapNames = reinterpret_cast<const IndexString *>(pos);
+        m_PokemonNames = m_MapNames + head->mapNames;
+        m_ItemNames = m_PokemonNames + head->pokemonNames;
+        pos += strings * sizeof(IndexString);
+        m_Chars = reinterpret_cast<const UInt16 *>(pos);
+
+
+        // Verifies that all references stay within the image
+        for (UInt32 i = 0; i < head->banks; i++)
+        {
+            if (static_cast<quint64>(m_Banks[i].first) + m_Banks[i].count > head->maps)
+                return false;
+        }
+
+        for (quint64 i = 0; i < strings; i++)
+        {
+            if (static_cast<quint64>(m_MapNames[i].start) + m_MapNames[i].length > head->chars)
+                return false;
+        }
+
+        m_Head = head;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Nothing is copied out of the mapping; the accessors read
+    // the records right where they are stored.
+    //
+    ///////////////////////////////////////////////////////////
+    bool IndexCache::load(quint64 key)
+    {
+        m_File.setFileName(filePath(key));
+        if (!m_File.open(QIODevice::ReadOnly))
+            return false;
+
+        m_Mapped = m_File.map(0, m_File.size());
+        if (m_Mapped != NULL && attach(m_Mapped, m_File.size()))
+        {
+            // Rejects files of other keys
+            if (m_Head->key == key)
+            {
+                // Marks the index as recently used for the eviction
+                m_File.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+                return true;
+            }
+        }
+
+        m_Head = NULL;
+        if (m_Mapped != NULL)
+            m_File.unmap(m_Mapped);
+
+        m_Mapped = NULL;
+        m_File.close();
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The file is replaced atomically, so that an interrupted
+    // write never leaves a damaged index behind. Old indices
+    // are evicted afterwards.
+    //
+    ///////////////////////////////////////////////////////////
+    bool IndexCache::save(quint64 key) const
+    {
+        if (m_Image.isEmpty())
+            return false;
+
+        const QString path = filePath(key);
+        const QString folder = QFileInfo(path).absolutePath();
+        if (!QDir().mkpath(folder))
+            return false;
+
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly))
+            return false;
+
+        // The captured image is written as is, along with the key
+        QByteArray image = m_Image;
+        reinterpret_cast<IndexHead *>(image.data())->key = key;
+
+        if (file.write(image) != image.size())
+        {
+            file.cancelWriting();
+            return false;
+        }
+
+        if (!file.commit())
+            return false;
+
+        evict(folder);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Builds the image in the file format, so that it is read
+    // through the same accessors as a loaded file.
+    //
+    ///////////////////////////////////////////////////////////
+    void IndexCache::capture()
+    {
+        QVector<IndexBank> banks;
+        QVector<UInt32> maps;
+        QVector<IndexWildLink> wildLinks;
+        for (int i = 0; i < dat_MapBankTable->banks().size(); i++)
+        {
+            const MapBank *bank = dat_MapBankTable->banks().at(i);
+            IndexBank entry;
+            entry.offset = bank->offset();
+            entry.first = maps.size();
+            entry.count = bank->maps().size();
+
+            for (int j = 0; j < bank->maps().size(); j++)
+            {
+                const Map *map = bank->maps().at(j);
+                maps.push_back(map->offset());
+
+                if (map->wildpokeTable() != -1)
+                {
+                    IndexWildLink link;
+                    link.bank = i;
+                    link.map = j;
+                    link.table = map->wildpokeTable();
+                    wildLinks.push_back(link);
+                }
+            }
+
+            banks.push_back(entry);
+        }
+
+        QVector<UInt32> layouts;
+        for (UInt32 i = 0; i < dat_MapLayoutTable->count(); i++)
+            layouts.push_back(dat_MapLayoutTable->layoutOffset(i));
+
+        QStringList mapNames;
+        foreach (const MapName *name, dat_MapNameTable->names())
+            mapNames.push_back(name->name);
+
+
+        // Concatenates the characters of all names
+        const QStringList nameLists[] { mapNames, dat_PokemonTable->names(), dat_ItemTable->names() };
+        QVector<IndexString> strings;
+        QString chars;
+        for (int i = 0; i < 3; i++)
+        {
+            foreach (const QString &name, nameLists[i])
+            {
+                IndexString string;
+                string.start = chars.size();
+                string.length = name.size();
+                strings.push_back(string);
+                chars.append(name);
+            }
+        }
+
+        IndexHead head;
+        head.magic = IDX_MAGIC;
+        head.version = IDX_VERSION;
+        head.key = 0;
+        head.banks = banks.size();
+        head.maps = maps.size();
+        head.layouts = layouts.size();
+        head.wildLinks = wildLinks.size();
+        head.mapNames = nameLists[0].size();
+        head.pokemonNames = nameLists[1].size();
+        head.itemNames = nameLists[2].size();
+        head.chars = chars.size();
+
+
+        // Writes the records in the order of the counts
+        m_Image.clear();
+        AME_IC_Append(m_Image, &head, sizeof(IndexHead));
+        AME_IC_Append(m_Image, banks.constData(), banks.size() * sizeof(IndexBank));
+        AME_IC_Append(m_Image, maps.constData(), maps.size() * sizeof(UInt32));
+        AME_IC_Append(m_Image, layouts.constData(), layouts.size() * sizeof(UInt32));
+        AME_IC_Append(m_Image, wildLinks.constData(), wildLinks.size() * sizeof(IndexWildLink));
+        AME_IC_Append(m_Image, strings.constData(), strings.size() * sizeof(IndexString));
+        AME_IC_Append(m_Image, chars.utf16(), chars.size() * sizeof(UInt16));
+
+        attach(reinterpret_cast<const uchar *>(m_Image.constData()), m_Image.size());
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QStringList IndexCache::names(const IndexString *strings, UInt32 count) const
+    {
+        QStringList list;
+        list.reserve(count);
+        for (UInt32 i = 0; i < count; i++)
+        {
+            const QChar *name = reinterpret_cast<const QChar *>(m_Chars + strings[i].start);
+            list.push_back(QString(name, strings[i].length));
+        }
+
+        return list;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 IndexCache::bankCount() const
+    {
+        return (m_Head != NULL) ? m_Head->banks : 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const IndexBank *IndexCache::banks() const
+    {
+        return m_Banks;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const UInt32 *IndexCache::maps() const
+    {
+        return m_Maps;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 IndexCache::layoutCount() const
+    {
+        return (m_Head != NULL) ? m_Head->layouts : 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const UInt32 *IndexCache::layouts() const
+    {
+        return m_Layouts;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 IndexCache::wildLinkCount() const
+    {
+        return (m_Head != NULL) ? m_Head->wildLinks : 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const IndexWildLink *IndexCache::wildLinks() const
+    {
+        return m_WildLinks;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QStringList IndexCache::mapNames() const
+    {
+        return (m_Head != NULL) ? names(m_MapNames, m_Head->mapNames) : QStringList();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QStringList IndexCache::pokemonNames() const
+    {
+        return (m_Head != NULL) ? names(m_PokemonNames, m_Head->pokemonNames) : QStringList();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QStringList IndexCache::itemNames() const
+    {
+        return (m_Head != NULL) ? names(m_ItemNames, m_Head->itemNames) : QStringList();
+    }
+}
@@ -36,10 +36,20 @@
 //
 ///////////////////////////////////////////////////////////
 #include <AME/System/LoadedData.hpp>
+#include <AME/Graphics/BlocksetCache.hpp>
 #include <AME/System/Configuration.hpp>
-#include <AME/Widgets/Misc/Messages.hpp>
+#include <AME/System/ErrorStack.hpp>
+#include <AME/System/IndexCache.hpp>
+#include <AME/System/RomCursor.hpp>
+#include <AME/System/Settings.hpp>
+#include <AME/System/Tracer.hpp>
 #include <AME/Text/String.hpp>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QFutureSynchronizer>
 #include <QDateTime>
+#include <QCoreApplication>
+#include <QFile>
+#include <QDir>
 
 
 namespace ame
@@ -55,25 +65,67 @@ namespace ame
     PokemonTable *dat_PokemonTable = NULL;
     ItemTable *dat_ItemTable = NULL;
     MapNameTable *dat_MapNameTable = NULL;
+    RomData *dat_RomData = NULL;
+    FreespaceIndex *dat_FreespaceIndex = NULL;
 
 
     ///////////////////////////////////////////////////////////
-    // Function type:  I/O
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   7/5/2016
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Everything that influences the discovery of banks, maps
+    // and layouts is part of the key: the ROM contents, the
+    // configuration file and the map accuracy level.
     //
     ///////////////////////////////////////////////////////////
-    int loadAllMapData(const qboy::Rom &rom)
+    inline quint64 AME_LD_IndexKey()
     {
-        // First attempts to load the configuration file
-        if (!Configuration::parse(rom))
-            return -1;
+        quint64 key = IndexCache::hash(dat_RomData->data(), dat_RomData->size());
 
+        QFile config(Configuration::filePath(*dat_RomData));
+        if (config.open(QIODevice::ReadOnly))
+        {
+            const QByteArray yaml = config.readAll();
+            key = IndexCache::hash(reinterpret_cast<const UInt8 *>(yaml.constData()), yaml.size(), key);
+        }
 
+        const Int32 level = SETTINGS(MapAccuracyLevel);
+        return IndexCache::hash(reinterpret_cast<const UInt8 *>(&level), sizeof(level), key);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline int AME_LD_LoadTables(const QString &filePath)
+    {
         QTime stopWatch;
         stopWatch.start();
 
+        // Takes an immutable snapshot of the ROM, shared by all parsers
+        {
+            AME_TRACE("rom", "RomData::load");
+            dat_RomData = new RomData;
+            if (!dat_RomData->load(filePath))
+            {
+                AME_SILENT_THROW2(LDD_ERROR_ROM);
+                return -1;
+            }
+        }
+
+        // Attempts to load the configuration file for the game code
+        {
+            AME_TRACE("config", "Configuration::parse");
+            if (!Configuration::parse(RomCursor(*dat_RomData)))
+                return -1;
+        }
+
         // Allocates the tables on the dynamic heap
         dat_MapNameTable = new MapNameTable;
         dat_WildPokemonTable = new WildPokemonTable;
@@ -83,35 +135,108 @@ namespace ame
         dat_PokemonTable = new PokemonTable;
         dat_ItemTable = new ItemTable;
 
+        // Restores the results of the discovery from the index of
+        // a previous load, if neither ROM nor configuration changed
+        IndexCache index;
+        quint64 key;
+        bool indexed;
+        {
+            AME_TRACE("cache", "IndexCache::load");
+            key = AME_LD_IndexKey();
+            indexed = index.load(key);
+        }
+
+        // Most tables do not depend on each other and are read
+        // concurrently on the global thread pool; every task
+        // reads through its own cursor
+        QFutureSynchronizer<bool> tasks;
+
+        // Indexes the free space for repointing; the configured
+        // start may be a pointer as well as an offset
+        dat_FreespaceIndex = new FreespaceIndex;
+        tasks.addFuture(QtConcurrent::run([]() {
+            AME_TRACE("table", "FreespaceIndex");
+            dat_FreespaceIndex->build(*dat_RomData, CONFIG(FreespaceStart) & 0x1FFFFFF);
+            return true;
+        }));
+
         // Attempts to load map names
-        if(!dat_MapNameTable->read(rom, CONFIG(MapNames)))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([&index, indexed]() {
+            AME_TRACE("table", "MapNameTable");
+            const QStringList names = index.mapNames();
+            return dat_MapNameTable->read(RomCursor(*dat_RomData), CONFIG(MapNames),
+                                          indexed ? &names : NULL);
+        }));
 
         // Attempts to load the wild Pokémon
-        if (!dat_WildPokemonTable->read(rom, CONFIG(WildPokemon)))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([]() {
+            AME_TRACE("table", "WildPokemonTable");
+            return dat_WildPokemonTable->read(RomCursor(*dat_RomData), CONFIG(WildPokemon));
+        }));
 
         // Attempts to load the Pokémon table
-        if (!dat_PokemonTable->read(rom))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([&index, indexed]() {
+            AME_TRACE("table", "PokemonTable");
+            const QStringList names = index.pokemonNames();
+            return dat_PokemonTable->read(RomCursor(*dat_RomData),
+                                          indexed ? &names : NULL);
+        }));
 
         // Attempts to load the item table
-        if (!dat_ItemTable->read(rom))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([&index, indexed]() {
+            AME_TRACE("table", "ItemTable");
+            const QStringList names = index.itemNames();
+            return dat_ItemTable->read(RomCursor(*dat_RomData),
+                                       indexed ? &names : NULL);
+        }));
 
         // Attempts to load the overworld table
-        if (!dat_OverworldTable->read(rom))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([]() {
+            AME_TRACE("table", "OverworldTable");
+            return dat_OverworldTable->read(RomCursor(*dat_RomData));
+        }));
 
         // Attempts to load all the map banks
-        if (!dat_MapBankTable->read(rom, CONFIG(MapBanks)))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([&index, indexed]() {
+            AME_TRACE("table", "MapBankTable");
+            if (indexed)
+                return dat_MapBankTable->restore(RomCursor(*dat_RomData), CONFIG(MapBanks), index);
+            else
+                return dat_MapBankTable->read(RomCursor(*dat_RomData), CONFIG(MapBanks));
+        }));
 
         // Attempts to load the map layout table
-        if (!dat_MapLayoutTable->read(rom, CONFIG(MapLayouts)))
-            return -1;
+        tasks.addFuture(QtConcurrent::run([&index, indexed]() {
+            AME_TRACE("table", "MapLayoutTable");
+            if (indexed)
+                return dat_MapLayoutTable->restore(RomCursor(*dat_RomData), CONFIG(MapLayouts),
+                                                   index.layouts(), index.layoutCount());
+            else
+                return dat_MapLayoutTable->read(RomCursor(*dat_RomData), CONFIG(MapLayouts));
+        }));
+
+        // Joins all tasks before linking the tables to each other
+        tasks.waitForFinished();
+        foreach (const QFuture<bool> &task, tasks.futures())
+            if (!task.result())
+                return -1;
 
         // Map wild Pokémon indices to all the maps
+        if (indexed)
+        {
+            for (UInt32 i = 0; i < index.wildLinkCount(); i++)
+            {
+                const IndexWildLink &link = index.wildLinks()[i];
+                if ((int)link.bank < dat_MapBankTable->banks().size() &&
+                    (int)link.map  < dat_MapBankTable->banks().at(link.bank)->maps().size())
+                {
+                    dat_MapBankTable->banks()[link.bank]->maps()[link.map]->setWildTable(link.table);
+                }
+            }
+
+            return stopWatch.elapsed();
+        }
+
         for (int i = 0; i < dat_WildPokemonTable->tables().size(); i++)
         {
             quint8 bank = dat_WildPokemonTable->tables().at(i)->bank();
@@ -126,32 +251,221 @@ namespace ame
             }
         }
 
+        // Stores the index for the next load of this ROM
+        {
+            AME_TRACE("cache", "IndexCache::save");
+            index.capture();
+            index.save(key);
+        }
+
         return stopWatch.elapsed();
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // If requested in the settings, the timing spans of the
+    // load are written to the traces folder, even on failure.
+    // A tracer started by the caller is left running.
+    //
+    ///////////////////////////////////////////////////////////
+    int loadAllMapData(const QString &filePath)
+    {
+        const bool traceToFile = SETTINGS(TraceLoading) && !Tracer::isActive();
+        if (traceToFile)
+            Tracer::start();
+
+        int result;
+        {
+            AME_TRACE("load", "loadAllMapData");
+            result = AME_LD_LoadTables(filePath);
+        }
+
+        if (traceToFile)
+        {
+            Tracer::stop();
+
+            const QString folder = QCoreApplication::applicationDirPath() + "/traces/";
+            const QString fileName = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") + ".json";
+            if (QDir().mkpath(folder))
+                Tracer::write(folder + fileName);
+        }
+
+        return result;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline QList<Map *> AME_LD_LoadedMaps()
+    {
+        QList<Map *> maps;
+        foreach (MapBank *bank, dat_MapBankTable->banks())
+            foreach (Map *map, bank->maps())
+                if (map->isLoaded())
+                    maps.push_back(map);
+
+        return maps;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Only maps that were opened can have been modified. The
+    // wild Pokémon table is moved into free space if it outgrew
+    // its old location; other tables are rejected before
+    // anything is staged. The structures and the free space
+    // index are only updated once the ROM was written.
+    //
+    ///////////////////////////////////////////////////////////
+    bool saveAllMapData()
+    {
+        if (dat_RomData == NULL || !dat_RomData->isLoaded())
+            return ErrorStack::add(Q_FUNC_INFO, LDD_ERROR_SAVE);
+
+        const RomCursor rom(*dat_RomData);
+        const QList<MapHeader *> layouts = LayoutManager::modified();
+        const QList<Map *> maps = AME_LD_LoadedMaps();
+
+        // Determines whether all tables fit into their old location
+        foreach (Map *map, maps)
+        {
+            if ((map->entities().isModified() && map->entities().requiresRepoint(rom) != ET_Invalid) ||
+                (map->scripts().isModified() && map->scripts().requiresRepoint(rom)) ||
+                (map->connections().isModified() && map->connections().requiresRepoint(rom)))
+                return ErrorStack::add(Q_FUNC_INFO, LDD_ERROR_REPOINT);
+        }
+
+        // Reserves room for the wild Pokémon table, if necessary
+        const bool wildModified = dat_WildPokemonTable->isModified();
+        const UInt32 wildSize = dat_WildPokemonTable->dataSize();
+        UInt32 wildRepoint = 0;
+        if (wildModified && dat_WildPokemonTable->requiresRepoint(*dat_FreespaceIndex))
+        {
+            if ((wildRepoint = dat_FreespaceIndex->allocate(wildSize)) == 0)
+                return ErrorStack::add(Q_FUNC_INFO, LDD_ERROR_SPACE);
+        }
+
+
+        // Collects the write entries of all modified structures
+        QList<WriteEntry> entries;
+        foreach (MapHeader *layout, layouts)
+            entries.append(layout->write());
+
+        foreach (Map *map, maps)
+        {
+            if (map->entities().isModified())
+                entries.append(map->entities().write(QList<UInt32>()));
+            if (map->scripts().isModified())
+                entries.append(map->scripts().write());
+            if (map->connections().isModified())
+                entries.append(map->connections().write());
+        }
+
+        if (wildModified)
+        {
+            entries.append(dat_WildPokemonTable->write(wildRepoint));
+
+            // Redirects the pointer the configuration was read from
+            if (wildRepoint != 0)
+            {
+                WriteEntry pointerEntry { CONFIG(WildPokemonRef) };
+                pointerEntry.addPointer(wildRepoint);
+                entries.append(pointerEntry);
+            }
+        }
+
+
+        // Stages all entries and writes them in one go
+        bool written = true;
+        foreach (const WriteEntry &entry, entries)
+        {
+            if (!(written = dat_RomData->write(entry)))
+                break;
+        }
+
+        if (!written || !dat_RomData->flush())
+        {
+            dat_RomData->discard();
+            if (wildRepoint != 0)
+                dat_FreespaceIndex->free(wildRepoint, wildSize);
+
+            return ErrorStack::add(Q_FUNC_INFO, LDD_ERROR_SAVE);
+        }
+
+
+        // Everything is saved now
+        foreach (MapHeader *layout, layouts)
+            layout->setModified(false);
+
+        foreach (Map *map, maps)
+        {
+            if (map->entities().isModified())
+                map->entities().commit(QList<UInt32>());
+            if (map->scripts().isModified())
+                map->scripts().commit();
+            if (map->connections().isModified())
+                map->connections().commit();
+
+            map->entities().setModified(false);
+            map->scripts().setModified(false);
+            map->connections().setModified(false);
+        }
+
+        if (wildModified)
+            dat_WildPokemonTable->commit(*dat_FreespaceIndex, wildRepoint);
+
+        dat_WildPokemonTable->setModified(false);
+        return true;
+    }
+
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Pokedude
-    // Date of edit:   7/5/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     void clearAllMapData()
     {
-        if (dat_WildPokemonTable)
-            delete dat_WildPokemonTable;
-        if (dat_MapBankTable)
-            delete dat_MapBankTable;
-        if (dat_MapNameTable)
-            delete dat_MapNameTable;
-        if (dat_PokemonTable)
-            delete dat_PokemonTable;
-        if (dat_ItemTable)
-            delete dat_ItemTable;
-        if (dat_OverworldTable)
-            delete dat_OverworldTable;
+        delete dat_WildPokemonTable;
+        delete dat_MapBankTable;
+        delete dat_MapNameTable;
+        delete dat_PokemonTable;
+        delete dat_ItemTable;
+        delete dat_OverworldTable;
+        delete dat_MapLayoutTable;
 
+        // Tilesets decode their images from the ROM on demand
+        LayoutManager::clear();
         TilesetManager::clear();
+        BlocksetCache::clear();
+        delete dat_FreespaceIndex;
+        delete dat_RomData;
+
+        // Another ROM may be loaded afterwards
+        dat_WildPokemonTable = NULL;
+        dat_MapBankTable = NULL;
+        dat_MapNameTable = NULL;
+        dat_PokemonTable = NULL;
+        dat_ItemTable = NULL;
+        dat_OverworldTable = NULL;
+        dat_MapLayoutTable = NULL;
+        dat_FreespaceIndex = NULL;
+        dat_RomData = NULL;
     }
 }
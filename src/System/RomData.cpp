@@ -0,0 +1,508 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/RomData.hpp>
+#include <AME/System/SaveEngine.hpp>
+#include <QMutexLocker>
+#include <QWriteLocker>
+#include <cstring>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Local definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define RD_PAGE_SHIFT   12
+    #define RD_PAGE_SIZE    (1u << RD_PAGE_SHIFT)
+    #define RD_TITLE        0xA0    // Game title, 12 characters
+    #define RD_CODE         0xAC    // Game code, 4 characters
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    RomData::RomData()
+        : m_Data(NULL),
+          m_Size(0)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Destructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    RomData::~RomData()
+    {
+        close();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::load(const QString &filePath)
+    {
+        close();
+        if (!map(filePath))
+            return false;
+
+        m_FilePath = filePath;
+        return (m_Size != 0);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomData::close()
+    {
+        unmap();
+        m_FilePath.clear();
+        discard();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::map(const QString &filePath)
+    {
+        m_File.setFileName(filePath);
+        if (!m_File.open(QIODevice::ReadOnly))
+            return false;
+
+        // The mapping stays valid as long as the file is open
+        const qint64 size = m_File.size();
+        uchar *mapped = (size > 0) ? m_File.map(0, size) : NULL;
+        if (mapped != NULL)
+        {
+            m_Data = mapped;
+            m_Size = static_cast<UInt32>(size);
+        }
+        else
+        {
+            m_Buffer = m_File.readAll();
+            m_File.close();
+            m_Data = reinterpret_cast<const UInt8 *>(m_Buffer.constData());
+            m_Size = static_cast<UInt32>(m_Buffer.size());
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomData::unmap()
+    {
+        // Closing the file releases the mapping
+        if (m_File.isOpen())
+            m_File.close();
+
+        m_Buffer.clear();
+        m_Data = NULL;
+        m_Size = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::isLoaded() const
+    {
+        return (m_Data != NULL);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 RomData::size() const
+    {
+        return m_Size;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const UInt8 *RomData::data() const
+    {
+        return m_Data;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString RomData::filePath() const
+    {
+        return m_FilePath;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString RomData::code() const
+    {
+        if (!canRead(RD_CODE, 4))
+            return QString();
+
+        return QString::fromLatin1(reinterpret_cast<const char *>(m_Data) + RD_CODE, 4);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Unused characters of the title are zero.
+    //
+    ///////////////////////////////////////////////////////////
+    QString RomData::name() const
+    {
+        if (!canRead(RD_TITLE, 12))
+            return QString();
+
+        const char *title = reinterpret_cast<const char *>(m_Data) + RD_TITLE;
+        return QString::fromLatin1(title, qstrnlen(title, 12));
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::checkOffset(UInt32 offset) const
+    {
+        return (offset < size());
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::canRead(UInt32 offset, UInt32 count) const
+    {
+        return (offset <= size() && count <= size() - offset);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt8 RomData::readByte(UInt32 offset) const
+    {
+        if (!canRead(offset, 1))
+            return 0;
+
+        return data()[offset];
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt16 RomData::readHWord(UInt32 offset) const
+    {
+        if (!canRead(offset, 2))
+            return 0;
+
+        const UInt8 *bytes = data() + offset;
+        return (bytes[0] | (bytes[1] << 8));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 RomData::readWord(UInt32 offset) const
+    {
+        if (!canRead(offset, 4))
+            return 0;
+
+        const UInt8 *bytes = data() + offset;
+        return (bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((UInt32) bytes[3] << 24));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Anything that is not a ROM address yields an offset
+    // beyond the ROM, which fails any subsequent checkOffset.
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 RomData::readPointer(UInt32 offset) const
+    {
+        UInt32 pointer = readWord(offset);
+        if (pointer == 0x00000000)
+            return 0;
+
+        return (pointer - 0x08000000);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::write(const WriteEntry &entry)
+    {
+        const UInt32 size = static_cast<UInt32>(entry.data.size());
+        if (!canRead(entry.offset, size))
+            return false;
+
+        QMutexLocker lock(&m_OverlayLock);
+        for (UInt32 pos = 0; pos < size; )
+        {
+            const UInt32 offset = entry.offset + pos;
+            const UInt32 index = offset >> RD_PAGE_SHIFT;
+            const UInt32 start = offset & (RD_PAGE_SIZE - 1);
+            const UInt32 count = qMin(size - pos, RD_PAGE_SIZE - start);
+
+            // Copies the page on its first modification
+            QMap<UInt32, QByteArray>::iterator page = m_Overlay.find(index);
+            if (page == m_Overlay.end())
+            {
+                const UInt32 base = index << RD_PAGE_SHIFT;
+                const UInt32 length = qMin(RD_PAGE_SIZE, m_Size - base);
+                page = m_Overlay.insert(index, QByteArray(reinterpret_cast<const char *>(m_Data) + base, length));
+            }
+
+            std::memcpy(page->data() + start, entry.data.constData() + pos, count);
+            pos += count;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QByteArray RomData::readStaged(UInt32 offset, UInt32 count) const
+    {
+        if (count == 0 || !canRead(offset, count))
+            return QByteArray();
+
+        QByteArray result(reinterpret_cast<const char *>(m_Data) + offset, count);
+        const UInt32 last = (offset + count - 1) >> RD_PAGE_SHIFT;
+
+        // Replaces all bytes within modified pages
+        QMutexLocker lock(&m_OverlayLock);
+        QMap<UInt32, QByteArray>::const_iterator page = m_Overlay.lowerBound(offset >> RD_PAGE_SHIFT);
+        for (; page != m_Overlay.constEnd() && page.key() <= last; ++page)
+        {
+            const UInt32 base = page.key() << RD_PAGE_SHIFT;
+            const UInt32 begin = qMax(base, offset);
+            const UInt32 end = qMin(base + static_cast<UInt32>(page->size()), offset + count);
+            std::memcpy(result.data() + (begin - offset), page->constData() + (begin - base), end - begin);
+        }
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::isModified() const
+    {
+        QMutexLocker lock(&m_OverlayLock);
+        return !m_Overlay.isEmpty();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QList<WriteEntry> RomData::changes() const
+    {
+        QList<WriteEntry> entries;
+        QMutexLocker lock(&m_OverlayLock);
+
+        // Merges consecutive pages to a single entry
+        UInt32 next = 0;
+        QMap<UInt32, QByteArray>::const_iterator page = m_Overlay.constBegin();
+        for (; page != m_Overlay.constEnd(); ++page)
+        {
+            if (entries.isEmpty() || page.key() != next)
+                entries.push_back(WriteEntry(page.key() << RD_PAGE_SHIFT));
+
+            entries.last().data.append(page.value());
+            next = page.key() + 1;
+        }
+
+        return entries;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomData::discard()
+    {
+        QMutexLocker lock(&m_OverlayLock);
+        m_Overlay.clear();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QReadWriteLock *RomData::mapLock() const
+    {
+        return &m_MapLock;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The ROM is replaced by a new file, so the old mapping
+    // has to be released first (Windows refuses to replace a
+    // mapped file) and the new one mapped afterwards. Tilesets
+    // may still be decoding in the background; the write lock
+    // waits for them and blocks new ones until the remap.
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomData::flush()
+    {
+        if (!isLoaded())
+            return false;
+
+        SaveEngine engine;
+        engine.add(changes());
+        if (engine.isEmpty())
+            return true;
+
+        QWriteLocker lock(&m_MapLock);
+        const QString filePath = m_File.fileName();
+        unmap();
+
+        const bool saved = engine.commit(filePath);
+        if (!map(filePath))
+            return false;
+
+        if (saved)
+            discard();
+
+        return saved;
+    }
+}
@@ -0,0 +1,1070 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/Algorithm/Lz77.hpp>
+#include <AME/System/ErrorStack.hpp>
+#include <AME/System/RomGenerator.hpp>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QVector>
+#include <QDir>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Image layout
+    //
+    ///////////////////////////////////////////////////////////
+    #define RGN_SLOT_BASE       0x100       // Values and pointers referenced by the YAML
+    #define RGN_DATA_START      0x200       // First byte of generated content
+    #define RGN_MAX_SIZE        0x2000000   // GBA ROM address space
+    #define RGN_MIN_SIZE        0x100000    // Smallest padded image
+    #define RGN_POKEMON         412
+    #define RGN_ITEMS           375
+    #define RGN_OVERWORLDS      152
+    #define RGN_OW_PALETTES     4
+    #define RGN_SPRITES         8           // Distinct icons and overworld images
+    #define RGN_NAMES           64
+
+
+    ///////////////////////////////////////////////////////////
+    // Slots that the configuration file points to
+    //
+    ///////////////////////////////////////////////////////////
+    enum RomGeneratorSlot
+    {
+        RGS_PokemonCount,
+        RGS_PokemonNames,
+        RGS_PokemonIcons,
+        RGS_PokemonUsage,
+        RGS_PokemonPals,
+        RGS_WildPokemon,
+        RGS_ItemData,
+        RGS_ItemCount,
+        RGS_Overworlds,
+        RGS_OverworldPals,
+        RGS_OverworldCount,
+        RGS_FlyingLocs,
+        RGS_StartBank,
+        RGS_StartMap,
+        RGS_StartX,
+        RGS_StartY,
+        RGS_MapBanks,
+        RGS_MapLayouts,
+        RGS_MapNames,
+        RGS_MapNameCount,
+        RGS_MapNameTotal,
+        RGS_Count
+    };
+
+    const char *const AME_RG_SlotNames[RGS_Count] =
+    {
+        "PokemonCount", "PokemonNames", "PokemonIcons", "PokemonUsage", "PokemonPals",
+        "WildPokemon", "ItemData", "ItemCount", "Overworlds", "OverworldPals",
+        "OverworldCount", "FlyingLocs", "StartBank", "StartMap", "StartX", "StartY",
+        "MapBanks", "MapLayouts", "MapNames", "MapNameCount", "MapNameTotal"
+    };
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Xorshift32; the state must never be zero.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Random(UInt32 &state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Align(QByteArray &image)
+    {
+        while (image.size() & 3)
+            image.append('\0');
+
+        return image.size();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Byte(QByteArray &image, UInt8 value)
+    {
+        image.append(static_cast<char>(value));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_HWord(QByteArray &image, UInt16 value)
+    {
+        AME_RG_Byte(image, value & 0xFF);
+        AME_RG_Byte(image, value >> 8);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Word(QByteArray &image, UInt32 value)
+    {
+        AME_RG_HWord(image, value & 0xFFFF);
+        AME_RG_HWord(image, value >> 16);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Null pointers stay zero, everything else is mapped
+    // into the cartridge address space.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Address(UInt32 offset)
+    {
+        return (offset) ? (offset | 0x08000000) : 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Pointer(QByteArray &image, UInt32 offset)
+    {
+        AME_RG_Word(image, AME_RG_Address(offset));
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Patch(QByteArray &image, UInt32 offset, UInt32 value)
+    {
+        for (int i = 0; i < 4; i++)
+            image[offset + i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Encodes spaces, digits and latin letters, terminates
+    // the string with 0xFF and pads it to the given length.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_String(QByteArray &image, const QString &text, Int32 length)
+    {
+        foreach (const QChar &c, text)
+        {
+            if (c >= 'A' && c <= 'Z')
+                AME_RG_Byte(image, 0xBB + (c.unicode() - 'A'));
+            else if (c >= 'a' && c <= 'z')
+                AME_RG_Byte(image, 0xD5 + (c.unicode() - 'a'));
+            else if (c >= '0' && c <= '9')
+                AME_RG_Byte(image, 0xA1 + (c.unicode() - '0'));
+            else
+                AME_RG_Byte(image, 0x00);
+        }
+
+        AME_RG_Byte(image, 0xFF);
+        for (int i = text.size() + 1; i < length; i++)
+            AME_RG_Byte(image, 0x00);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Palettes(QByteArray &image, Int32 count, UInt32 &random)
+    {
+        for (int i = 0; i < count * 16; i++)
+            AME_RG_HWord(image, AME_RG_Random(random) & 0x7FFF);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Random 4bpp sprite with a transparent border pixel in
+    // every row, so that the images are not pure noise.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_RG_Sprite(QByteArray &image, Int32 bytes, UInt32 &random)
+    {
+        for (int i = 0; i < bytes; i++)
+        {
+            UInt8 pair = AME_RG_Random(random) & 0xFF;
+            if ((i % 4) == 0)
+                pair &= 0xF0;
+
+            AME_RG_Byte(image, pair);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Checked after every tileset and map, so that the image
+    // never grows much beyond the address space, no matter how
+    // many and how large maps were requested.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_RG_Exceeds(QByteArray &image)
+    {
+        if (image.size() <= RGN_MAX_SIZE)
+            return false;
+
+        image.clear();
+        image.squeeze();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The sizes match the ones Tileset::read expects. The
+    // first tile of a primary tileset stays transparent and
+    // fills all unused foreground slots. Every other tile
+    // is one of four two-colored patterns, which makes the
+    // image compressible like real tile graphics.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Tileset(QByteArray &image, BaseROMType type, bool secondary,
+                                 bool compressed, UInt32 &random)
+    {
+        const bool isFRLG = (type == RT_FRLG);
+        const Int32 split = (isFRLG) ? 0x280 : 0x200;
+        const Int32 blocks = (secondary) ? ((isFRLG) ? 384 : 512) : ((isFRLG) ? 640 : 512);
+        const Int32 size = (secondary) ? ((isFRLG) ? 24576 : 32768) : ((isFRLG) ? 40960 : 32768);
+        const Int32 palFirst = (secondary) ? ((isFRLG) ? 7 : 6) : 0;
+        const Int32 palCount = (secondary) ? ((isFRLG) ? 6 : 7) : ((isFRLG) ? 7 : 6);
+        const Int32 tileFirst = (secondary) ? split : 0;
+        const Int32 tileCount = (secondary) ? (0x400 - split) : split;
+
+
+        // Draws the tile patterns
+        QByteArray pixels(size, '\0');
+        UInt8 *raw = reinterpret_cast<UInt8 *>(pixels.data());
+        for (int t = (secondary) ? 0 : 1; t < size / 32; t++)
+        {
+            const UInt8 light = 1 + AME_RG_Random(random) % 15;
+            const UInt8 dark = 1 + AME_RG_Random(random) % 15;
+            const UInt32 pattern = AME_RG_Random(random) % 4;
+
+            for (int p = 0; p < 64; p++)
+            {
+                const int x = p % 8;
+                const int y = p / 8;
+                bool isLight;
+                if (pattern == 0)
+                    isLight = true;
+                else if (pattern == 1)
+                    isLight = (((x / 2) + (y / 2)) & 1);
+                else if (pattern == 2)
+                    isLight = (y & 2);
+                else
+                    isLight = ((x + y) & 4);
+
+                const UInt8 color = (isLight) ? light : dark;
+                UInt8 &pair = raw[t * 32 + p / 2];
+                pair = (p & 1) ? (pair | (color << 4)) : color;
+            }
+        }
+
+        const UInt32 ptrImage = AME_RG_Align(image);
+        image.append((compressed) ? Lz77::compress(pixels) : pixels);
+
+        const UInt32 ptrPalette = AME_RG_Align(image);
+        AME_RG_Palettes(image, 16, random);
+
+
+        // Builds the blocks from tiles and palettes of this tileset
+        const UInt32 ptrBlocks = AME_RG_Align(image);
+        for (int i = 0; i < blocks; i++)
+        {
+            const bool hasForeground = ((AME_RG_Random(random) % 4) == 0);
+            for (int k = 0; k < 8; k++)
+            {
+                UInt16 tile = 0;
+                if (k < 4 || hasForeground)
+                {
+                    tile = tileFirst + AME_RG_Random(random) % tileCount;
+                    tile |= (AME_RG_Random(random) % 4) << 10;
+                    tile |= (palFirst + AME_RG_Random(random) % palCount) << 12;
+                }
+
+                AME_RG_HWord(image, tile);
+            }
+        }
+
+        const UInt32 ptrBehaviour = AME_RG_Align(image);
+        for (int i = 0; i < blocks; i++)
+        {
+            const UInt8 behaviour = ((AME_RG_Random(random) % 8) == 0) ? (AME_RG_Random(random) & 0xFF) : 0;
+            if (isFRLG)
+            {
+                AME_RG_HWord(image, behaviour);
+                AME_RG_HWord(image, 0);
+            }
+            else
+            {
+                AME_RG_Byte(image, behaviour);
+                AME_RG_Byte(image, 0);
+            }
+        }
+
+
+        // Writes the tileset structure
+        const UInt32 header = AME_RG_Align(image);
+        AME_RG_Byte(image, (compressed) ? 1 : 0);
+        AME_RG_Byte(image, (secondary) ? 1 : 0);
+        AME_RG_HWord(image, 0);
+        AME_RG_Pointer(image, ptrImage);
+        AME_RG_Pointer(image, ptrPalette);
+        AME_RG_Pointer(image, ptrBlocks);
+        AME_RG_Pointer(image, (isFRLG) ? 0 : ptrBehaviour);
+        AME_RG_Pointer(image, (isFRLG) ? ptrBehaviour : 0);
+
+        return header;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Blocks are placed in horizontal runs of random length,
+    // so that fills and searches meet coherent areas.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Layout(QByteArray &image, BaseROMType type, const QSize &size,
+                                UInt32 primary, UInt32 secondary, UInt32 &random)
+    {
+        const UInt32 ptrBorder = AME_RG_Align(image);
+        for (int i = 0; i < 4; i++)
+            AME_RG_HWord(image, AME_RG_Random(random) % 0x400);
+
+        const UInt32 ptrBlocks = AME_RG_Align(image);
+        UInt16 block = 0;
+        for (int i = 0; i < size.width() * size.height(); i++)
+        {
+            if ((i % size.width()) == 0 || (AME_RG_Random(random) % 4) == 0)
+                block = AME_RG_Random(random) % 0x400;
+
+            const UInt16 permission = ((AME_RG_Random(random) % 8) == 0) ? 0x01 : 0x0C;
+            AME_RG_HWord(image, block | (permission << 10));
+        }
+
+        const UInt32 header = AME_RG_Align(image);
+        AME_RG_Word(image, size.width());
+        AME_RG_Word(image, size.height());
+        AME_RG_Pointer(image, ptrBorder);
+        AME_RG_Pointer(image, ptrBlocks);
+        AME_RG_Pointer(image, primary);
+        AME_RG_Pointer(image, secondary);
+
+        // Only FRLG stores the border size
+        if (type == RT_FRLG)
+        {
+            AME_RG_Byte(image, 2);
+            AME_RG_Byte(image, 2);
+            AME_RG_HWord(image, 0);
+        }
+
+        return header;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Warps, triggers and signs are left empty; their
+    // pointers still reference valid (zeroed) memory.
+    //
+    ///////////////////////////////////////////////////////////
+    inline UInt32 AME_RG_Events(QByteArray &image, Int32 npcs, const QSize &size,
+                                UInt32 script, UInt32 empty, UInt32 &random)
+    {
+        UInt32 ptrNpcs = empty;
+        if (npcs > 0)
+        {
+            ptrNpcs = AME_RG_Align(image);
+            for (int i = 0; i < npcs; i++)
+            {
+                AME_RG_Byte(image, i + 1);
+                AME_RG_Byte(image, AME_RG_Random(random) % RGN_OVERWORLDS);
+                AME_RG_HWord(image, 0);
+                AME_RG_HWord(image, AME_RG_Random(random) % size.width());
+                AME_RG_HWord(image, AME_RG_Random(random) % size.height());
+                AME_RG_Byte(image, 3);      // level
+                AME_RG_Byte(image, 1 + AME_RG_Random(random) % 8);
+                AME_RG_Byte(image, 0x11);   // movement radius
+                AME_RG_Byte(image, 0);
+                AME_RG_HWord(image, 0);     // property
+                AME_RG_HWord(image, 0);     // view radius
+                AME_RG_Pointer(image, script);
+                AME_RG_HWord(image, 0);     // flag
+                AME_RG_HWord(image, 0);
+            }
+        }
+
+        const UInt32 events = AME_RG_Align(image);
+        AME_RG_Byte(image, npcs);
+        AME_RG_Byte(image, 0);
+        AME_RG_Byte(image, 0);
+        AME_RG_Byte(image, 0);
+        AME_RG_Pointer(image, ptrNpcs);
+        AME_RG_Pointer(image, empty);
+        AME_RG_Pointer(image, empty);
+        AME_RG_Pointer(image, empty);
+
+        return events;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    RomGenerator::RomGenerator()
+        : m_Type(RT_FRLG),
+          m_Banks(43),
+          m_Maps(10),
+          m_MinSize(20, 20),
+          m_MaxSize(60, 60),
+          m_Primary(4),
+          m_Secondary(40),
+          m_Compressed(true),
+          m_Npcs(4),
+          m_Seed(0x414D4531),
+          m_Freespace(0)
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The image starts with a cartridge header, followed by
+    // the slots the configuration file points to. Everything
+    // else is appended behind, 4-byte aligned. All tables are
+    // terminated the way the discovery in MapBankTable,
+    // MapLayoutTable, WildPokemonTable and OverworldTable
+    // expects it.
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomGenerator::generate()
+    {
+        if (m_Banks < 1 || m_Banks > 255 || m_Maps < 1 || m_Maps > 255)
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_BANKS);
+        if (m_MinSize.width() < 1 || m_MinSize.height() < 1 ||
+            m_MaxSize.width() > 1024 || m_MaxSize.height() > 1024 ||
+            m_MaxSize.width() < m_MinSize.width() || m_MaxSize.height() < m_MinSize.height())
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_SIZE);
+        if (m_Primary < 1 || m_Secondary < 1)
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_TILESETS);
+        if (m_Npcs < 0 || m_Npcs > 255)
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_NPCS);
+
+        UInt32 random = (m_Seed) ? m_Seed : 1;
+        QVector<UInt32> slots(RGS_Count, 0);
+        QByteArray &image = m_Image;
+        image.fill('\0', RGN_DATA_START);
+
+
+        // Writes the cartridge header; the Nintendo logo is omitted
+        const QByteArray title("AME FIXTURE");
+        const QByteArray gameCode = code().toLatin1();
+        AME_RG_Patch(image, 0x00, 0xEA00002E);
+        image.replace(0xA0, title.size(), title);
+        image.replace(0xAC, gameCode.size(), gameCode);
+        image.replace(0xB0, 2, "01");
+        image[0xB2] = static_cast<char>(0x96);
+
+        UInt8 checksum = 0;
+        for (int i = 0xA0; i < 0xBD; i++)
+            checksum -= static_cast<UInt8>(image.at(i));
+        image[0xBD] = static_cast<char>(checksum - 0x19);
+
+
+        // Data shared by many structures
+        const UInt32 empty = AME_RG_Align(image);
+        image.append(QByteArray(32, '\0'));
+        const UInt32 script = AME_RG_Align(image);
+        AME_RG_Byte(image, 0x02); // end
+
+
+        // Pokémon palettes, icons, palette usage and names
+        slots[RGS_PokemonPals] = AME_RG_Address(AME_RG_Align(image));
+        AME_RG_Palettes(image, 3, random);
+
+        QVector<UInt32> icons;
+        for (int i = 0; i < RGN_SPRITES; i++)
+        {
+            icons.push_back(AME_RG_Align(image));
+            AME_RG_Sprite(image, 512, random);
+        }
+
+        slots[RGS_PokemonIcons] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < RGN_POKEMON; i++)
+            AME_RG_Pointer(image, icons.at(i % RGN_SPRITES));
+
+        slots[RGS_PokemonUsage] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < RGN_POKEMON; i++)
+            AME_RG_Byte(image, i % 3);
+
+        slots[RGS_PokemonNames] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < RGN_POKEMON; i++)
+            AME_RG_String(image, QString("PKMN%1").arg(i), 11);
+
+        slots[RGS_PokemonCount] = RGN_POKEMON - 1;
+
+
+        // Items; the configuration stores half of the count
+        slots[RGS_ItemData] = AME_RG_Address(AME_RG_Align(image));
+        slots[RGS_ItemCount] = RGN_ITEMS / 2;
+        for (int i = 0; i < (RGN_ITEMS / 2) * 2 + 1; i++)
+        {
+            AME_RG_String(image, QString("ITEM%1").arg(i), 14);
+            AME_RG_HWord(image, i);
+            image.append(QByteArray(0x2C - 16, '\0'));
+        }
+
+
+        // Overworld palettes, terminated by an empty entry
+        QVector<UInt32> owPalettes;
+        for (int i = 0; i < RGN_OW_PALETTES; i++)
+        {
+            owPalettes.push_back(AME_RG_Align(image));
+            AME_RG_Palettes(image, 1, random);
+        }
+
+        slots[RGS_OverworldPals] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < RGN_OW_PALETTES; i++)
+        {
+            AME_RG_Pointer(image, owPalettes.at(i));
+            AME_RG_HWord(image, 0x1100 + i);
+            AME_RG_HWord(image, 0);
+        }
+        image.append(QByteArray(8, '\0'));
+
+        // Overworld sprites (16x32) and their frame tables
+        QVector<UInt32> frames;
+        for (int i = 0; i < RGN_SPRITES; i++)
+        {
+            const UInt32 sprite = AME_RG_Align(image);
+            AME_RG_Sprite(image, 256, random);
+
+            frames.push_back(AME_RG_Align(image));
+            AME_RG_Pointer(image, sprite);
+            AME_RG_HWord(image, 256);
+            AME_RG_HWord(image, 0);
+        }
+
+        QVector<UInt32> overworlds;
+        for (int i = 0; i < RGN_OVERWORLDS; i++)
+        {
+            overworlds.push_back(AME_RG_Align(image));
+            AME_RG_HWord(image, 0xFFFF);
+            AME_RG_HWord(image, 0x1100 + i % RGN_OW_PALETTES);
+            AME_RG_HWord(image, 0x11FF);
+            AME_RG_HWord(image, 256);
+            AME_RG_HWord(image, 16);
+            AME_RG_HWord(image, 32);
+            image.append(QByteArray(16, '\0'));
+            AME_RG_Pointer(image, frames.at(i % RGN_SPRITES));
+            AME_RG_Pointer(image, 0);
+        }
+
+        slots[RGS_Overworlds] = AME_RG_Address(AME_RG_Align(image));
+        slots[RGS_OverworldCount] = RGN_OVERWORLDS - 1;
+        for (int i = 0; i < RGN_OVERWORLDS; i++)
+            AME_RG_Pointer(image, overworlds.at(i));
+
+
+        // Tilesets
+        QVector<UInt32> primaries;
+        QVector<UInt32> secondaries;
+        for (int i = 0; i < m_Primary; i++)
+        {
+            primaries.push_back(AME_RG_Tileset(image, m_Type, false, m_Compressed, random));
+            if (AME_RG_Exceeds(image))
+                return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_FULL);
+        }
+        for (int i = 0; i < m_Secondary; i++)
+        {
+            secondaries.push_back(AME_RG_Tileset(image, m_Type, true, m_Compressed, random));
+            if (AME_RG_Exceeds(image))
+                return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_FULL);
+        }
+
+
+        // Map names; one per bank, counted differently per game
+        const Int32 nameCount = qMin(m_Banks, RGN_NAMES);
+        QVector<UInt32> names;
+        for (int i = 0; i < nameCount; i++)
+        {
+            names.push_back(image.size());
+            AME_RG_String(image, QString("BANK %1").arg(i), 0);
+        }
+
+        slots[RGS_MapNames] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < nameCount; i++)
+        {
+            if (m_Type != RT_FRLG)
+            {
+                AME_RG_Byte(image, i % 28);
+                AME_RG_Byte(image, i / 28);
+                AME_RG_Byte(image, 1);
+                AME_RG_Byte(image, 1);
+            }
+
+            AME_RG_Pointer(image, names.at(i));
+        }
+
+        Int32 nameFirst = 0;
+        if (m_Type == RT_FRLG)
+        {
+            nameFirst = 0x58;
+            slots[RGS_MapNameCount] = nameCount - 1;
+            slots[RGS_MapNameTotal] = nameFirst + nameCount;
+        }
+        else if (m_Type == RT_RS)
+        {
+            slots[RGS_MapNameCount] = nameCount;
+            slots[RGS_MapNameTotal] = nameCount;
+        }
+        else
+        {
+            slots[RGS_MapNameCount] = nameCount - 1;
+            slots[RGS_MapNameTotal] = nameCount - 1;
+        }
+
+
+        // Layouts, events and map headers
+        QVector<UInt32> layouts;
+        QVector<QVector<UInt32>> banks(m_Banks);
+        for (int b = 0; b < m_Banks; b++)
+        {
+            for (int m = 0; m < m_Maps; m++)
+            {
+                const Int32 index = b * m_Maps + m;
+                const QSize size(m_MinSize.width() + AME_RG_Random(random) % (m_MaxSize.width() - m_MinSize.width() + 1),
+                                 m_MinSize.height() + AME_RG_Random(random) % (m_MaxSize.height() - m_MinSize.height() + 1));
+
+                const UInt32 layout = AME_RG_Layout(image, m_Type, size, primaries.at(index % m_Primary),
+                                                    secondaries.at(index % m_Secondary), random);
+                const UInt32 events = AME_RG_Events(image, m_Npcs, size, script, empty, random);
+                layouts.push_back(layout);
+
+                banks[b].push_back(AME_RG_Align(image));
+                AME_RG_Pointer(image, layout);
+                AME_RG_Pointer(image, events);
+                AME_RG_Pointer(image, 0);   // scripts
+                AME_RG_Pointer(image, 0);   // connections
+                AME_RG_HWord(image, 0x12C); // music
+                AME_RG_HWord(image, layouts.size());
+                AME_RG_Byte(image, nameFirst + b % nameCount);
+                AME_RG_Byte(image, 0);      // darkness
+                AME_RG_Byte(image, 2);      // weather
+                AME_RG_Byte(image, 1);      // map type
+                AME_RG_Byte(image, 0);
+                AME_RG_Byte(image, 0);
+                AME_RG_Byte(image, 1);
+                AME_RG_Byte(image, 0);      // battle type
+
+                if (AME_RG_Exceeds(image))
+                    return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_FULL);
+            }
+        }
+
+
+        // Map lists per bank, bank table and layout table, each
+        // terminated by an invalid pointer
+        QVector<UInt32> bankLists;
+        for (int b = 0; b < m_Banks; b++)
+        {
+            bankLists.push_back(AME_RG_Align(image));
+            foreach (UInt32 map, banks.at(b))
+                AME_RG_Pointer(image, map);
+
+            AME_RG_Word(image, 0xFFFFFFFF);
+        }
+
+        slots[RGS_MapBanks] = AME_RG_Address(AME_RG_Align(image));
+        foreach (UInt32 list, bankLists)
+            AME_RG_Pointer(image, list);
+        AME_RG_Word(image, 0xFFFFFFFF);
+
+        slots[RGS_MapLayouts] = AME_RG_Address(AME_RG_Align(image));
+        foreach (UInt32 layout, layouts)
+            AME_RG_Pointer(image, layout);
+        AME_RG_Word(image, 0xFFFFFFFF);
+
+
+        // Wild Pokémon: grass on every map, water on every third
+        QVector<UInt32> grass;
+        QVector<UInt32> water;
+        for (int i = 0; i < m_Banks * m_Maps; i++)
+        {
+            UInt32 areas[2] = { 0, 0 };
+            const Int32 counts[2] = { 12, (i % 3 == 0) ? 5 : 0 };
+            for (int a = 0; a < 2; a++)
+            {
+                if (counts[a] == 0)
+                    continue;
+
+                const UInt32 entries = AME_RG_Align(image);
+                for (int e = 0; e < counts[a]; e++)
+                {
+                    const UInt8 level = 2 + AME_RG_Random(random) % 60;
+                    AME_RG_Byte(image, level);
+                    AME_RG_Byte(image, level + AME_RG_Random(random) % 4);
+                    AME_RG_HWord(image, 1 + AME_RG_Random(random) % (RGN_POKEMON - 1));
+                }
+
+                areas[a] = AME_RG_Align(image);
+                AME_RG_Byte(image, (a == 0) ? 20 : 4);
+                AME_RG_Byte(image, 0);
+                AME_RG_HWord(image, 0);
+                AME_RG_Pointer(image, entries);
+            }
+
+            grass.push_back(areas[0]);
+            water.push_back(areas[1]);
+        }
+
+        if (AME_RG_Exceeds(image))
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_FULL);
+
+        slots[RGS_WildPokemon] = AME_RG_Address(AME_RG_Align(image));
+        for (int i = 0; i < m_Banks * m_Maps; i++)
+        {
+            AME_RG_Byte(image, i / m_Maps);
+            AME_RG_Byte(image, i % m_Maps);
+            AME_RG_HWord(image, 0);
+            AME_RG_Pointer(image, grass.at(i));
+            AME_RG_Pointer(image, water.at(i));
+            AME_RG_Pointer(image, 0);
+            AME_RG_Pointer(image, 0);
+        }
+        AME_RG_Word(image, 0x0000FFFF);
+        image.append(QByteArray(16, '\0'));
+
+
+        // Remaining values and the slots themselves
+        slots[RGS_FlyingLocs] = AME_RG_Address(empty);
+        slots[RGS_StartX] = m_MinSize.width() / 2;
+        slots[RGS_StartY] = m_MinSize.height() / 2;
+        for (int i = 0; i < RGS_Count; i++)
+            AME_RG_Patch(image, RGN_SLOT_BASE + i * 4, slots.at(i));
+
+
+        // Pads the image to a cartridge size with free space
+        m_Freespace = AME_RG_Align(image);
+        if (AME_RG_Exceeds(image))
+            return ErrorStack::add(Q_FUNC_INFO, RGN_ERROR_FULL);
+
+        Int32 padded = RGN_MIN_SIZE;
+        while (padded < image.size())
+            padded *= 2;
+
+        image.append(QByteArray(padded - image.size(), static_cast<char>(0xFF)));
+
+
+        // Generates the matching configuration file
+        QString config;
+        config += "#\n# AME Configuration File\n# Generated fixture, do not edit\n#\n\n";
+        config += QString("RomType:          %1\n").arg(static_cast<int>(m_Type));
+        config += QString("Name:             Synthetic %1 (AME)\n").arg(code());
+        config += QString("Language:         English\n\n");
+        for (int i = 0; i < RGS_Count; i++)
+        {
+            const QString key = QString(AME_RG_SlotNames[i]) + ":";
+            config += QString("%1 0x%2\n").arg(key, -17).arg(QString::number(RGN_SLOT_BASE + i * 4, 16).toUpper());
+        }
+
+        const QString emptyHex = QString::number(empty, 16).toUpper();
+        config += QString("\nSpriteNormalSet:  0x%1\n").arg(emptyHex);
+        config += QString("SpriteSmallSet:   0x%1\n").arg(emptyHex);
+        config += QString("SpriteLargeSet:   0x%1\n\n").arg(emptyHex);
+        config += QString("WorldMapCount:    0\n");
+        config += QString("WorldMapGFX:      []\n");
+        config += QString("WorldMapTileMap:  []\n");
+        config += QString("WorldMapPal:      []\n\n");
+        config += QString("FreespaceStart:   0x%1\n").arg(QString::number(m_Freespace, 16).toUpper());
+
+        m_Config = config.toUtf8();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool RomGenerator::save(const QString &romPath, const QString &configPath) const
+    {
+        const QByteArray *contents[2] = { &m_Image, &m_Config };
+        const QString paths[2] = { romPath, configPath };
+
+        for (int i = 0; i < 2; i++)
+        {
+            QDir().mkpath(QFileInfo(paths[i]).absolutePath());
+
+            QSaveFile file(paths[i]);
+            if (!file.open(QIODevice::WriteOnly))
+                return false;
+
+            file.write(*contents[i]);
+            if (!file.commit())
+                return false;
+        }
+
+        return true;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const QByteArray &RomGenerator::image() const
+    {
+        return m_Image;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    const QByteArray &RomGenerator::config() const
+    {
+        return m_Config;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString RomGenerator::code() const
+    {
+        if (m_Type == RT_FRLG)
+            return "ZFRE";
+        else if (m_Type == RT_RS)
+            return "ZRSE";
+        else
+            return "ZEME";
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    UInt32 RomGenerator::freespace() const
+    {
+        return m_Freespace;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setType(BaseROMType type)
+    {
+        m_Type = type;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setBanks(Int32 banks, Int32 maps)
+    {
+        m_Banks = banks;
+        m_Maps = maps;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setMapSize(const QSize &min, const QSize &max)
+    {
+        m_MinSize = min;
+        m_MaxSize = max;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setTilesets(Int32 primary, Int32 secondary)
+    {
+        m_Primary = primary;
+        m_Secondary = secondary;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setCompressed(bool compressed)
+    {
+        m_Compressed = compressed;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setNpcs(Int32 npcs)
+    {
+        m_Npcs = npcs;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void RomGenerator::setSeed(UInt32 seed)
+    {
+        m_Seed = seed;
+    }
+}
@@ -0,0 +1,378 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/ErrorStack.hpp>
+#include <AME/System/SaveEngine.hpp>
+#include <QTemporaryFile>
+#include <QFileInfo>
+#include <QVector>
+#include <QPair>
+#include <algorithm>
+#include <cstring>
+
+#ifdef Q_OS_WIN
+    #include <windows.h>
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <cstdio>
+#endif
+
+#ifdef Q_OS_LINUX
+    #include <sys/ioctl.h>
+    #include <linux/fs.h>
+#endif
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Local definitions
+    //
+    ///////////////////////////////////////////////////////////
+    #define SE_COPY_CHUNK   0x100000
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Writes at the given position without going through the
+    // buffer and the cursor of QFile.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_SE_WriteAt(QFile &file, UInt32 offset, const char *data, qint64 size)
+    {
+    #ifdef Q_OS_WIN
+        return (file.seek(offset) && file.write(data, size) == size && file.flush());
+    #else
+        while (size > 0)
+        {
+            const ssize_t written = ::pwrite(file.handle(), data, size, offset);
+            if (written <= 0)
+                return false;
+
+            data += written;
+            offset += written;
+            size -= written;
+        }
+
+        return true;
+    #endif
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Lets the file system share the blocks of the ROM where
+    // it can (e.g. btrfs and XFS), and only falls back to
+    // copying through memory elsewhere.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_SE_Clone(QFile &source, QFile &target)
+    {
+        const qint64 size = source.size();
+
+    #ifdef Q_OS_LINUX
+        if (::ioctl(target.handle(), FICLONE, source.handle()) == 0)
+            return true;
+
+        // Copies within the kernel, which may still share blocks
+        loff_t in = 0, out = 0;
+        while (in < size)
+        {
+            const ssize_t copied = ::copy_file_range(source.handle(), &in, target.handle(), &out, size - in, 0);
+            if (copied <= 0)
+                break;
+        }
+
+        if (in == size)
+            return true;
+    #endif
+
+        QByteArray chunk;
+        for (qint64 pos = 0; pos < size; pos += chunk.size())
+        {
+            if (!source.seek(pos))
+                return false;
+
+            chunk = source.read(qMin<qint64>(SE_COPY_CHUNK, size - pos));
+            if (chunk.isEmpty() || !AME_SE_WriteAt(target, pos, chunk.constData(), chunk.size()))
+                return false;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_SE_Sync(QFile &file)
+    {
+        if (!file.flush())
+            return false;
+
+    #ifdef Q_OS_WIN
+        return FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(file.handle())));
+    #else
+        return (::fsync(file.handle()) == 0);
+    #endif
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // QFile::rename refuses to overwrite, so the atomic rename
+    // of the system is used. The directory is synced as well,
+    // otherwise the rename itself might not survive a crash.
+    //
+    ///////////////////////////////////////////////////////////
+    inline bool AME_SE_Replace(const QString &from, const QString &to)
+    {
+    #ifdef Q_OS_WIN
+        return MoveFileExW(reinterpret_cast<const wchar_t *>(from.utf16()),
+                           reinterpret_cast<const wchar_t *>(to.utf16()),
+                           MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+    #else
+        if (::rename(QFile::encodeName(from).constData(), QFile::encodeName(to).constData()) != 0)
+            return false;
+
+        const int dir = ::open(QFile::encodeName(QFileInfo(to).absolutePath()).constData(), O_RDONLY);
+        if (dir != -1)
+        {
+            ::fsync(dir);
+            ::close(dir);
+        }
+
+        return true;
+    #endif
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    SaveEngine::SaveEngine()
+    {
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void SaveEngine::add(const WriteEntry &entry)
+    {
+        if (!entry.data.isEmpty())
+            m_Entries.push_back(entry);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void SaveEngine::add(const QList<WriteEntry> &entries)
+    {
+        foreach (const WriteEntry &entry, entries)
+            add(entry);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void SaveEngine::clear()
+    {
+        m_Entries.clear();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool SaveEngine::isEmpty() const
+    {
+        return m_Entries.isEmpty();
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The merged ranges are determined first; the entries are
+    // then copied into them in the order they were added.
+    //
+    ///////////////////////////////////////////////////////////
+    QList<WriteEntry> SaveEngine::coalesce() const
+    {
+        QVector<QPair<UInt32, UInt32>> ranges;
+        ranges.reserve(m_Entries.size());
+        foreach (const WriteEntry &entry, m_Entries)
+            ranges.push_back(qMakePair(entry.offset, entry.offset + static_cast<UInt32>(entry.data.size())));
+
+        std::sort(ranges.begin(), ranges.end());
+
+        QVector<UInt32> starts;
+        QVector<UInt32> ends;
+        for (int i = 0; i < ranges.size(); i++)
+        {
+            if (!ends.isEmpty() && ranges.at(i).first <= ends.last())
+            {
+                ends.last() = qMax(ends.last(), ranges.at(i).second);
+                continue;
+            }
+
+            starts.push_back(ranges.at(i).first);
+            ends.push_back(ranges.at(i).second);
+        }
+
+        QList<WriteEntry> merged;
+        for (int i = 0; i < starts.size(); i++)
+        {
+            merged.push_back(WriteEntry(starts.at(i)));
+            merged.last().data.resize(ends.at(i) - starts.at(i));
+        }
+
+        foreach (const WriteEntry &entry, m_Entries)
+        {
+            const int index = std::upper_bound(starts.constBegin(), starts.constEnd(), entry.offset) - starts.constBegin() - 1;
+            WriteEntry &range = merged[index];
+            std::memcpy(range.data.data() + (entry.offset - range.offset), entry.data.constData(), entry.data.size());
+        }
+
+        return merged;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The temporary file lives next to the ROM, as renaming is
+    // only atomic within the same file system. It is removed
+    // automatically if any step fails.
+    //
+    ///////////////////////////////////////////////////////////
+    bool SaveEngine::commit(const QString &filePath)
+    {
+        const QList<WriteEntry> entries = coalesce();
+        if (entries.isEmpty())
+            return true;
+
+        QFile source(filePath);
+        if (!source.open(QIODevice::ReadOnly))
+            return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_OPEN);
+
+        foreach (const WriteEntry &entry, entries)
+        {
+            if (entry.offset + static_cast<UInt32>(entry.data.size()) > source.size())
+                return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_RANGE, entry.offset);
+        }
+
+        QTemporaryFile temp(QFileInfo(filePath).absoluteFilePath() + ".XXXXXX");
+        if (!temp.open())
+            return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_TEMP);
+
+        if (!AME_SE_Clone(source, temp))
+            return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_COPY);
+
+        source.close();
+
+
+        // Writes the merged ranges and makes them durable
+        foreach (const WriteEntry &entry, entries)
+        {
+            if (!AME_SE_WriteAt(temp, entry.offset, entry.data.constData(), entry.data.size()))
+                return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_WRITE, entry.offset);
+        }
+
+        if (!AME_SE_Sync(temp))
+            return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_SYNC);
+
+        temp.setPermissions(QFileInfo(filePath).permissions());
+        temp.close();
+
+
+        // Replaces the ROM by the saved copy
+        if (!AME_SE_Replace(temp.fileName(), filePath))
+            return ErrorStack::add(Q_FUNC_INFO, SE_ERROR_REPLACE);
+
+        temp.setAutoRemove(false);
+        m_Entries.clear();
+        return true;
+    }
+}
@@ -36,9 +36,11 @@
 //
 ///////////////////////////////////////////////////////////
 #include <AME/System/Settings.hpp>
-#include <AME/Widgets/Misc/Messages.hpp>
+#ifdef AME_EDITOR
+    #include <AME/Widgets/Misc/Messages.hpp>
+#endif
 #include <yaml-cpp/yaml.h>
-#include <QApplication>
+#include <QCoreApplication>
 #include <QFileInfo>
 #include <QFile>
 #include <QDebug>
@@ -63,21 +65,47 @@ namespace ame
     bool Settings::ShowRawLayoutHeader;
     bool Settings::ShowGrid;
     int Settings::MapAccuracyLevel;
+    bool Settings::TraceLoading;
     QList<QString> Settings::RecentFiles;
 	float Settings::ScaleFactor;
 
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Headless builds have no message boxes and print the
+    // message to the console instead.
+    //
+    ///////////////////////////////////////////////////////////
+    inline void AME_ST_Report(const QString &message, bool isError)
+    {
+    #ifdef AME_EDITOR
+        if (isError)
+            Messages::showError(NULL, message);
+        else
+            Messages::showMessage(NULL, message);
+    #else
+        Q_UNUSED(isError);
+        qWarning("%s", qPrintable(message));
+    #endif
+    }
+
+
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Diegoisawesome, Pokedude, Nekaida
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   4/21/2017
+    // Contributors:   Diegoisawesome, Pokedude, Nekaida, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     bool Settings::parse()
     {
         // Builds the path to the YAML file
-        const QString appFolder = QApplication::applicationDirPath();
+        const QString appFolder = QCoreApplication::applicationDirPath();
         const QString subFolder = "/config/";
         const QString fileName = "AME.yaml";
         QString filePath = appFolder + subFolder + fileName;
@@ -90,7 +118,7 @@ namespace ame
             settings = YAML::LoadFile(filePath.toStdString());
 
         if (settings.IsNull())
-            Messages::showMessage(NULL, QObject::tr("AME configuration file (AME.yaml) not found.\nLoading default settings."));
+            AME_ST_Report(QObject::tr("AME configuration file (AME.yaml) not found.\nLoading default settings."), false);
 
         // Tries to parse all the properties
         ScaleFactor         = settings["ScaleFactor"].as<float>(1);
@@ -108,6 +136,7 @@ namespace ame
         ShowRawLayoutHeader = settings["ShowRawLayoutHeader"].as<bool>(false);
         ShowGrid = settings["ShowGrid"].as<bool>(false);
         MapAccuracyLevel    = settings["MapAccuracyLevel"].as<int>(4);
+        TraceLoading        = settings["TraceLoading"].as<bool>(false);
         if (settings["LastPath"].Type() != YAML::NodeType::Null)
             LastPath        = QString::fromStdString(settings["LastPath"].as<std::string>(""));
         else
@@ -127,29 +156,29 @@ namespace ame
     
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   4/21/2017
+    // Contributors:   Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     bool Settings::write()
     {
         // Builds the path to the YAML file
-        const QString appFolder = QApplication::applicationDirPath();
+        const QString appFolder = QCoreApplication::applicationDirPath();
         const QString subFolder = "/config/";
         const QString fileName = "AME.yaml";
         QString filePath = appFolder + subFolder + fileName;
 
         if (!QDir().mkpath(appFolder + subFolder))
         {
-            Messages::showError(NULL, QObject::tr("Error creating config folder.\nConfiguration could not be saved."));
+            AME_ST_Report(QObject::tr("Error creating config folder.\nConfiguration could not be saved."), true);
             return false;
         }
 
         QFile file(filePath);
         if (!file.open(QIODevice::ReadWrite))
         {
-            Messages::showError(NULL, QObject::tr("Error writing to configuration file AME.yaml.\nConfiguration could not be saved."));
+            AME_ST_Report(QObject::tr("Error writing to configuration file AME.yaml.\nConfiguration could not be saved."), true);
             return false;
         }
 
@@ -171,6 +200,7 @@ namespace ame
         settings["ShowRawLayoutHeader"] = ShowRawLayoutHeader;
         settings["ShowGrid"]            = ShowGrid;
         settings["MapAccuracyLevel"]    = MapAccuracyLevel;
+        settings["TraceLoading"]        = TraceLoading;
         settings["LastPath"]            = LastPath.toStdString();
 
         YAML::Node RecentFileNode;
@@ -0,0 +1,303 @@
+//////////////////////////////////////////////////////////////////////////////////
+//
+//
+//                     d88b         888b           d888  888888888888
+//                    d8888b        8888b         d8888  888
+//                   d88''88b       888'8b       d8'888  888
+//                  d88'  '88b      888 '8b     d8' 888  8888888
+//                 d88Y8888Y88b     888  '8b   d8'  888  888
+//                d88""""""""88b    888   '8b d8'   888  888
+//               d88'        '88b   888    '888'    888  888
+//              d88'          '88b  888     '8'     888  888888888888
+//
+//
+// AwesomeMapEditor: A map editor for GBA Pokémon games.
+// Copyright (C) 2016 Diegoisawesome, Pokedude
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////
+// Include files
+//
+///////////////////////////////////////////////////////////
+#include <AME/System/Tracer.hpp>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QThread>
+#include <QFile>
+#include <QMap>
+
+
+namespace ame
+{
+    ///////////////////////////////////////////////////////////
+    // Static variable definition
+    //
+    ///////////////////////////////////////////////////////////
+    QList<TraceEvent> Tracer::m_Events;
+    QHash<Qt::HANDLE, Int32> Tracer::m_Threads;
+    QElapsedTimer Tracer::m_Clock;
+    QAtomicInt Tracer::m_Active;
+    QMutex Tracer::m_Mutex;
+
+
+    ///////////////////////////////////////////////////////////
+    /// \brief Accumulated statistics of one trace category.
+    ///
+    ///////////////////////////////////////////////////////////
+    struct TracePhase
+    {
+        Int32 count;
+        qint64 total;
+        qint64 longest;
+
+        TracePhase() : count(0), total(0), longest(0) { }
+    };
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    inline QMap<QString, TracePhase> AME_TR_Phases(const QList<TraceEvent> &events)
+    {
+        QMap<QString, TracePhase> phases;
+        foreach (const TraceEvent &event, events)
+        {
+            TracePhase &phase = phases[event.category];
+            qint64 duration = event.end - event.begin;
+
+            phase.count++;
+            phase.total += duration;
+            phase.longest = qMax(phase.longest, duration);
+        }
+
+        return phases;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void Tracer::start()
+    {
+        QMutexLocker lock(&m_Mutex);
+        m_Events.clear();
+        m_Threads.clear();
+        m_Clock.start();
+        m_Active.storeRelease(1);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void Tracer::stop()
+    {
+        m_Active.storeRelease(0);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool Tracer::isActive()
+    {
+        return m_Active.loadAcquire() != 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    qint64 Tracer::now()
+    {
+        return m_Clock.nsecsElapsed();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Setter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void Tracer::record(const char *category, const QString &name, qint64 begin, qint64 end)
+    {
+        if (!isActive())
+            return;
+
+        QMutexLocker lock(&m_Mutex);
+        Qt::HANDLE handle = QThread::currentThreadId();
+        QHash<Qt::HANDLE, Int32>::const_iterator it = m_Threads.constFind(handle);
+        if (it == m_Threads.constEnd())
+            it = m_Threads.insert(handle, m_Threads.size() + 1);
+
+        TraceEvent event;
+        event.category = category;
+        event.name = name;
+        event.begin = begin;
+        event.end = end;
+        event.thread = it.value();
+        m_Events.push_back(event);
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QString Tracer::summary()
+    {
+        QMutexLocker lock(&m_Mutex);
+        QMap<QString, TracePhase> phases = AME_TR_Phases(m_Events);
+
+        QString text;
+        for (QMap<QString, TracePhase>::const_iterator it = phases.constBegin(); it != phases.constEnd(); ++it)
+        {
+            text += QString("%1: %2 spans, %3 ms total, %4 ms longest\n")
+                    .arg(it.key())
+                    .arg(it->count)
+                    .arg(it->total / 1000000.0, 0, 'f', 2)
+                    .arg(it->longest / 1000000.0, 0, 'f', 2);
+        }
+
+        return text;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Chrome expects timestamps and durations in microseconds.
+    // Spans of the same thread nest by their time range.
+    //
+    ///////////////////////////////////////////////////////////
+    bool Tracer::write(const QString &filePath)
+    {
+        QMutexLocker lock(&m_Mutex);
+        QJsonArray events;
+
+        // Names the threads by the order of their first span
+        for (QHash<Qt::HANDLE, Int32>::const_iterator it = m_Threads.constBegin(); it != m_Threads.constEnd(); ++it)
+        {
+            QJsonObject args;
+            args["name"] = QString("Thread %1").arg(it.value());
+
+            QJsonObject meta;
+            meta["name"] = QString("thread_name");
+            meta["ph"] = QString("M");
+            meta["pid"] = 1;
+            meta["tid"] = it.value();
+            meta["args"] = args;
+            events.append(meta);
+        }
+
+        foreach (const TraceEvent &event, m_Events)
+        {
+            QJsonObject span;
+            span["name"] = event.name;
+            span["cat"] = QString(event.category);
+            span["ph"] = QString("X");
+            span["ts"] = event.begin / 1000.0;
+            span["dur"] = (event.end - event.begin) / 1000.0;
+            span["pid"] = 1;
+            span["tid"] = event.thread;
+            events.append(span);
+        }
+
+        // Adds the per-phase summary
+        QJsonObject summary;
+        QMap<QString, TracePhase> phases = AME_TR_Phases(m_Events);
+        for (QMap<QString, TracePhase>::const_iterator it = phases.constBegin(); it != phases.constEnd(); ++it)
+        {
+            QJsonObject phase;
+            phase["count"] = it->count;
+            phase["totalMs"] = it->total / 1000000.0;
+            phase["longestMs"] = it->longest / 1000000.0;
+            summary[it.key()] = phase;
+        }
+
+        QJsonObject otherData;
+        otherData["summary"] = summary;
+
+        QJsonObject root;
+        root["traceEvents"] = events;
+        root["displayTimeUnit"] = QString("ms");
+        root["otherData"] = otherData;
+
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return false;
+
+        return file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) >= 0;
+    }
+
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Constructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    TraceSpan::TraceSpan(const char *category, const QString &name)
+        : m_Category(category),
+          m_Name(name),
+          m_Begin(-1)
+    {
+        if (Tracer::isActive())
+            m_Begin = Tracer::now();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Destructor
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    TraceSpan::~TraceSpan()
+    {
+        if (m_Begin >= 0)
+            Tracer::record(m_Category, m_Name, m_Begin, Tracer::now());
+    }
+}
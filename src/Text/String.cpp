@@ -38,6 +38,7 @@
 #include <AME/Text/String.hpp>
 #include <AME/Text/Tables.hpp>
 #include <AME/System/Configuration.hpp>
+#include <AME/System/Tracer.hpp>
 #include <QMap>
 
 
@@ -62,10 +63,11 @@ namespace ame
     // Member functions
     //
     ///////////////////////////////////////////////////////////
-    const QString String::read(const qboy::Rom &rom, UInt32 offset)
+    const QString String::read(const RomCursor &rom, UInt32 offset)
     {
         // Firstly, determines whether the given rom is valid
-        Q_ASSERT(rom.info().isLoaded() && rom.info().isValid());
+        Q_ASSERT(rom.data().isLoaded());
+        AME_TRACE("string", QString("String 0x%1").arg(offset, 0, 16));
 
         // Declares needed variables for the decoding process
         QList<UInt8> encoded;
@@ -73,8 +75,8 @@ namespace ame
         UInt8 readByte;
 
         // Declares the different dynamic tables (some are the same across all roms)
-        QMap<UInt32, QString> *mapBuffers = NULL;
-        QMap<UInt32, QString> *mapFunctions = NULL;
+        const QMap<UInt32, QString> *mapBuffers = NULL;
+        const QMap<UInt32, QString> *mapFunctions = NULL;
 
         // Determines the rom version and depending on that, loads the tables
         if (CONFIG(RomType) == RT_FRLG)
@@ -114,8 +116,8 @@ namespace ame
                 UInt32 search = ((currentChar << 8) | arg1);
 
                 // Searches for the sequence in the symbol-map
-                auto searchResult = SymbolSequences.find(search);
-                if (searchResult != SymbolSequences.end())
+                auto searchResult = SymbolSequences.constFind(search);
+                if (searchResult != SymbolSequences.constEnd())
                     decoded.push_back(searchResult.value());
                 else
                     decoded.push_back(convertRaw(search));
@@ -127,8 +129,8 @@ namespace ame
                 UInt32 search = ((currentChar << 8) | arg1);
 
                 // Searches for the sequence in the dynamic buffer-map
-                auto searchResult = mapBuffers->find(search);
-                if (searchResult != mapBuffers->end())
+                auto searchResult = mapBuffers->constFind(search);
+                if (searchResult != mapBuffers->constEnd())
                     decoded.push_back(searchResult.value());
                 else
                     decoded.push_back(convertRaw(search));
@@ -151,8 +153,8 @@ namespace ame
                 }
 
                 // Searches for the sequence in the dynamic escape-map
-                auto searchResult = mapFunctions->find(search);
-                if (searchResult != mapFunctions->end())
+                auto searchResult = mapFunctions->constFind(search);
+                if (searchResult != mapFunctions->constEnd())
                     decoded.push_back(searchResult.value());
                 else
                     decoded.push_back(convertRaw(search));
@@ -37,36 +37,42 @@
 ///////////////////////////////////////////////////////////
 #include <AME/System/Configuration.hpp>
 #include <AME/System/Settings.hpp>
+#include <AME/Graphics/MapRenderer.hpp>
+#include <AME/Mapping/MapFill.hpp>
 #include <AME/Widgets/Rendering/AMEMapView.h>
 #include <AME/Widgets/Rendering/AMEEntityView.h>
 #include <AME/Widgets/Rendering/AMEBlockView.h>
 #include <QImage>
 
 
+///////////////////////////////////////////////////////////
+// Local definitions
+//
+///////////////////////////////////////////////////////////
+#define MV_TILE_SIZE    256
+
+
 namespace ame
 {
     ///////////////////////////////////////////////////////////
     // Local buffers
     //
     ///////////////////////////////////////////////////////////
-    UInt8 pixelBuffer[64];
     UInt8 blockBuffer[256];
 
 
     ///////////////////////////////////////////////////////////
     // Function type:  Constructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
 	AMEMapView::AMEMapView(QWidget *parent)
 		: QWidget(parent),
-		m_PrimaryForeground(0),
-		m_PrimaryBackground(0),
-		m_SecondaryForeground(0),
-		m_SecondaryBackground(0),
+		m_TileColumns(0),
 		m_ShowSprites(false),
+		m_Header(NULL),
 		m_MovementMode(false),
 		m_BlockView(0),
 		m_FirstBlock(QPoint(-1, -1)),
@@ -79,15 +85,16 @@ namespace ame
 		m_HoveredConnection(0),
 		m_IsInit(false),
         m_MovePerm(QImage(":/images/PermGL.png")),
+        m_EditDepth(0),
 		m_Cursor()
     {
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Destructor
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     AMEMapView::~AMEMapView()
@@ -96,38 +103,8 @@ namespace ame
             delete[] v;
         foreach (UInt8 *v, m_ForePixelBuffers)
             delete[] v;
-
-        delete[] m_PrimaryForeground;
-        delete[] m_PrimaryBackground;
-        delete[] m_SecondaryForeground;
-        delete[] m_SecondaryBackground;
-    }
-
-
-    ///////////////////////////////////////////////////////////
-    // Function type:  Helper
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
-    //
-    ///////////////////////////////////////////////////////////
-    inline void updatePixels(int x, int y, int w, int h, QImage &i, uchar *src)
-    {
-        if (x >= i.width() || y >= i.height())
-            return;
-        for (int px = 0; px < w; px++)
-            for (int py = 0; py < h; py++)
-                i.bits()[x+px+((y+py)*i.width())] = src[px+py*w];
     }
 
-    inline void updatePixels(int x1, int y1, int w1, int h1, QPixmap &p,
-                             int x2, int y2, int w2, int h2, QImage &i)
-    {
-        QPainter painter(&p);
-        painter.setCompositionMode(QPainter::CompositionMode_Source);
-        painter.drawImage(QRect(x1,y1,w1,h1), i, QRect(x2,y2,w2,h2));
-        painter.end();
-    }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Helper
@@ -157,67 +134,7 @@ namespace ame
     // Date of edit:   6/17/2016
     //
     ///////////////////////////////////////////////////////////
-    inline void flipVertically(UInt8 *dest, UInt8 *pixels)
-    {
-        for (int i = 0; i < 8; i++)
-            for (int j = 0; j < 8; j++)
-                dest[i + j * 8] = pixels[i + (8-1-j) * 8];
-    }
-
-    ///////////////////////////////////////////////////////////
-    // Function type:  Helper
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
-    //
-    ///////////////////////////////////////////////////////////
-    inline void flipHorizontally(UInt8 *dest, UInt8 *pixels)
-    {
-        for (int i = 0; i < 64; i++)
-            dest[i] = pixels[i - 2*(i%8) + 8-1];
-    }
-
-    ///////////////////////////////////////////////////////////
-    // Function type:  Helper
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
-    //
-    ///////////////////////////////////////////////////////////
-    inline void extractTile(const QByteArray &img, Tile &tile)
-    {
-        unsigned char buffer[64];
-        int x = (tile.tile % 16) * 8;
-        int y = (tile.tile / 16) * 8;
-        int pos = 0;
-
-        for (int y2 = 0; y2 < 8; y2++)
-            for (int x2 = 0; x2 < 8; x2++)
-                pixelBuffer[pos++] = (UInt8)((img.at((x+x2) + (y+y2) * 128)) + (tile.palette * 16));
-
-        if (tile.flipX)
-        {
-            flipHorizontally(buffer, pixelBuffer);
-            if (tile.flipY)
-                flipVertically(pixelBuffer, buffer);
-            else
-                memcpy(pixelBuffer, buffer, 64);
-        }
-        else if (tile.flipY)
-        {
-            flipVertically(buffer, pixelBuffer);
-            memcpy(pixelBuffer, buffer, 64);
-        }
-    }
-
-    ///////////////////////////////////////////////////////////
-    // Function type:  Helper
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
-    //
-    ///////////////////////////////////////////////////////////
-    inline void extractBlock(UInt8 *pixels, UInt16 block)
+    inline void extractBlock(const UInt8 *pixels, UInt16 block)
     {
         int x = (block % 8) * 16;
         int y = (block / 8) * 16;
@@ -289,7 +206,7 @@ namespace ame
 		if (!rect.isNull())
 		{
 
-			repaint();
+			update(blockRect(rect));
 		}
 		/*
         int mouseX = event->pos().x();
@@ -371,125 +288,11 @@ namespace ame
         }
         else if (currentTool == AMEMapView::Tool::Fill)
         {
-            MapBlock oldBlock = *header->getBlock(mouseX/16, mouseY/16);
-
-            QQueue<QPoint> queue;
-            QVector<Boolean> done = QVector<Boolean>(header->blocks().length());
-            queue.enqueue(QPoint(mouseX/16, mouseY/16));
-            while (!queue.isEmpty())
-            {
-                QPoint cur = queue.dequeue();
-                int placeX = (cur.x() % selectionWidth) - hOffset;
-                int placeY = (cur.y() % selectionHeight) - vOffset;
-
-                if (placeX < 0)
-                    placeX += selectionWidth;
-                if (placeY < 0)
-                    placeY += selectionHeight;
-
-                if (placeBlock(cur.x(), cur.y(), newBlocks[placeX + (placeY * selectionWidth)]))
-                {
-
-                    if (!m_MovementMode)
-                    {
-                        if (!done[cur.x() + (cur.y() - 1) * header->size().width()] &&
-                                header->getBlock(cur.x(), cur.y() - 1) != NULL &&
-                                header->getBlock(cur.x(), cur.y() - 1)->block == oldBlock.block)
-                        {
-                            queue.enqueue(QPoint(cur.x(), cur.y() - 1));
-                            done[cur.x() + (cur.y() - 1) * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() + (cur.y() + 1) * header->size().width()] &&
-                                header->getBlock(cur.x(), cur.y() + 1) != NULL &&
-                                header->getBlock(cur.x(), cur.y() + 1)->block == oldBlock.block)
-                        {
-                            queue.enqueue(QPoint(cur.x(), cur.y() + 1));
-                            done[cur.x() + (cur.y() + 1) * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() - 1 + cur.y() * header->size().width()] &&
-                                header->getBlock(cur.x() - 1, cur.y()) != NULL &&
-                                header->getBlock(cur.x() - 1, cur.y())->block == oldBlock.block)
-                        {
-                            queue.enqueue(QPoint(cur.x() - 1, cur.y()));
-                            done[cur.x() - 1 + cur.y() * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() + 1 + cur.y() * header->size().width()] &&
-                                header->getBlock(cur.x() + 1, cur.y()) != NULL &&
-                                header->getBlock(cur.x() + 1, cur.y())->block == oldBlock.block)
-                        {
-                            queue.enqueue(QPoint(cur.x() + 1, cur.y()));
-                            done[cur.x() + 1 + cur.y() * header->size().width()] = true;
-                        }
-                    }
-                    else
-                    {
-                        if (!done[cur.x() + (cur.y() - 1) * header->size().width()] &&
-                                header->getBlock(cur.x(), cur.y() - 1) != NULL &&
-                                header->getBlock(cur.x(), cur.y() - 1)->permission == oldBlock.permission)
-                        {
-                            queue.enqueue(QPoint(cur.x(), cur.y() - 1));
-                            done[cur.x() + (cur.y() - 1) * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() + (cur.y() + 1) * header->size().width()] &&
-                                header->getBlock(cur.x(), cur.y() + 1) != NULL &&
-                                header->getBlock(cur.x(), cur.y() + 1)->permission == oldBlock.permission)
-                        {
-                            queue.enqueue(QPoint(cur.x(), cur.y() + 1));
-                            done[cur.x() + (cur.y() + 1) * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() - 1 + cur.y() * header->size().width()] &&
-                                header->getBlock(cur.x() - 1, cur.y()) != NULL &&
-                                header->getBlock(cur.x() - 1, cur.y())->permission == oldBlock.permission)
-                        {
-                            queue.enqueue(QPoint(cur.x() - 1, cur.y()));
-                            done[cur.x() - 1 + cur.y() * header->size().width()] = true;
-                        }
-
-                        if (!done[cur.x() + 1 + cur.y() * header->size().width()] &&
-                                header->getBlock(cur.x() + 1, cur.y()) != NULL &&
-                                header->getBlock(cur.x() + 1, cur.y())->permission == oldBlock.permission)
-                        {
-                            queue.enqueue(QPoint(cur.x() + 1, cur.y()));
-                            done[cur.x() + 1 + cur.y() * header->size().width()] = true;
-                        }
-                    }
-                }
-
-            }
+            fill(QPoint(mouseX/16, mouseY/16), newBlocks, QSize(selectionWidth, selectionHeight));
         }
         else if (currentTool == AMEMapView::Tool::FillAll)
         {
-            MapBlock oldBlock = *header->getBlock(mouseX/16, mouseY/16);
-            for (int i = 0; i < header->size().height(); i++)
-            {
-                for (int j = 0; j < header->size().width(); j++)
-                {
-                    int placeX = (j % selectionWidth) - hOffset;
-                    int placeY = (i % selectionHeight) - vOffset;
-
-                    if (placeX < 0)
-                        placeX += selectionWidth;
-                    if (placeY < 0)
-                        placeY += selectionHeight;
-
-                    if (!m_MovementMode)
-                    {
-                        if (header->getBlock(j, i)->block == oldBlock.block)
-                            placeBlock(j, i, newBlocks[placeX + (placeY * selectionWidth)]);
-                    }
-                    else
-                    {
-                        if (header->getBlock(j, i)->permission == oldBlock.permission)
-                            placeBlock(j, i, newBlocks[placeX + (placeY * selectionWidth)]);
-                    }
-                }
-            }
-
+            fillAll(QPoint(mouseX/16, mouseY/16), newBlocks, QSize(selectionWidth, selectionHeight));
         }
         repaint();
 		*/
@@ -506,6 +309,7 @@ namespace ame
     {
         //m_CursorColor = Qt::GlobalColor::red;
 
+        beginEdit();
         for (int i = 0; i < selectionHeight; i++)
         {
             for (int j = 0; j < selectionWidth; j++)
@@ -521,18 +325,23 @@ namespace ame
                 }
             }
         }
+        endEdit();
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Helper
-    // Contributors:   Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   10/31/2016
+    // Contributors:   Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     bool AMEMapView::placeBlock(int x, int y, MapBlock newBlock)
     {
-        QSize mapSize = m_Maps[0]->header().size();
+        MapHeader *header = editedHeader();
+        if (header == NULL)
+            return false;
+
+        QSize mapSize = header->size();
 
         /*if ((x + (y * mapSize.width())) >= (mapSize.width() * mapSize.height()))
             return false;*/
@@ -541,38 +350,153 @@ namespace ame
             x >= mapSize.width() || y >= mapSize.height())
             return false;
 
-        MapBlock* block = m_Maps[0]->header().getBlock(x, y);
-        if (block == NULL)
+        MapBlockGrid &blocks = header->blocks();
+        if (!blocks.contains(x, y))
             return false;
 
+        beginEdit();
         if (newBlock.block >= 0)
         {
-            block->block = newBlock.block;
-            x *= 16;
-            y *= 16;
+            // The image is updated once the edit ends
+            blocks.setBlock(x, y, newBlock.block);
+            m_EditCells.push_back(x + y * mapSize.width());
+        }
+
+        if (newBlock.permission >= 0)
+        {
+            blocks.setPermission(x, y, newBlock.permission);
+        }
+
+        m_EditRect |= QRect(x, y, 1, 1);
+        endEdit();
+        return true;
+    }
 
-            // Sets the block in the actual image (BG & FG)
-            int x2, y2;
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::beginEdit()
+    {
+        m_EditDepth++;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The blocks are copied from the cached blockset straight
+    // into the indexed map images; the pixmaps only receive
+    // the bounding rectangle of all changes.
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::endEdit()
+    {
+        if (m_EditDepth == 0 || --m_EditDepth > 0)
+            return;
+
+        MapHeader *header = editedHeader();
+        if (m_EditRect.isEmpty() || header == NULL)
+        {
+            m_EditCells.clear();
+            m_EditRect = QRect();
+            return;
+        }
 
-            x2 = (newBlock.block % 8) * 16;
-            y2 = (newBlock.block / 8) * 16;
+        const MapBlockGrid &blocks = header->blocks();
+        header->setModified(true);
 
-            updatePixels(x, y, 16, 16, m_MapBackground,
-                         x2,y2,16, 16, m_BlockBackground);
+        const Int32 countTotal = m_PrimaryBlockCount + m_SecondaryBlockCount;
+        const Int32 stride = m_iMapBackground.bytesPerLine();
+        const UInt8 *background = reinterpret_cast<const UInt8 *>(m_Blockset.background.constData());
+        const UInt8 *foreground = reinterpret_cast<const UInt8 *>(m_Blockset.foreground.constData());
+        UInt8 *backPixels = m_iMapBackground.bits();
+        UInt8 *forePixels = m_iMapForeground.bits();
 
-            x2 = (newBlock.block % 8) * 16;
-            y2 = (newBlock.block / 8) * 16;
+        foreach (Int32 cell, m_EditCells)
+        {
+            const Int32 block = blocks.data()[cell] & MBG_BLOCK_MASK;
+            if (block >= countTotal)
+                continue;
 
-            updatePixels(x, y, 16, 16, m_MapForeground,
-                         x2,y2,16, 16, m_BlockForeground);
+            const Int32 offset = (cell % blocks.width()) * 16 + (cell / blocks.width()) * 16 * stride;
+            MapRenderer::drawBlock(background, block, backPixels + offset, stride);
+            MapRenderer::drawBlock(foreground, block, forePixels + offset, stride);
         }
 
-        if (newBlock.permission >= 0)
+        // Uploads the changed area once per layer
+        if (!m_EditCells.isEmpty())
         {
-            block->permission = newBlock.permission;
+            const QRect area(m_EditRect.topLeft() * 16, m_EditRect.size() * 16);
+            QPainter painter(&m_MapBackground);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            painter.drawImage(area.topLeft(), m_iMapBackground, area);
+            painter.end();
+
+            painter.begin(&m_MapForeground);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            painter.drawImage(area.topLeft(), m_iMapForeground, area);
+            painter.end();
         }
 
-        return true;
+        if (!m_PermLayer.isNull())
+            renderPermissions(m_EditRect);
+
+        invalidateBlocks(m_EditRect);
+        m_EditCells.clear();
+        m_EditRect = QRect();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QRect AMEMapView::fill(const QPoint &pos, const QVector<MapBlock> &pattern, const QSize &patternSize)
+    {
+        MapHeader *header = editedHeader();
+        if (header == NULL)
+            return QRect();
+
+        MapBlockGrid &blocks = header->blocks();
+
+        beginEdit();
+        const QRect changed = MapFill::flood(blocks, pos, pattern, patternSize, m_MovementMode, &m_EditCells);
+        m_EditRect |= changed;
+        endEdit();
+
+        return changed;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QRect AMEMapView::fillAll(const QPoint &pos, const QVector<MapBlock> &pattern, const QSize &patternSize)
+    {
+        MapHeader *header = editedHeader();
+        if (header == NULL)
+            return QRect();
+
+        MapBlockGrid &blocks = header->blocks();
+
+        beginEdit();
+        const QRect changed = MapFill::replace(blocks, pos, pattern, patternSize, m_MovementMode, &m_EditCells);
+        m_EditRect |= changed;
+        endEdit();
+
+        return changed;
     }
 
     ///////////////////////////////////////////////////////////
@@ -672,7 +596,7 @@ namespace ame
 			{
 				m_CurrentMap.writeBlocks(rect);
 			}
-			repaint();
+			update(blockRect(rect));
 		}
 		/*
         int mouseX = event->pos().x();
@@ -871,13 +795,13 @@ namespace ame
     }
 
     ///////////////////////////////////////////////////////////
-    // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
-    bool AMEMapView::setMap(const qboy::Rom &rom, Map *mainMap)
+    void AMEMapView::clearMaps()
     {
         // Clears up previous buffers, if any
         foreach (UInt8 *v, m_BackPixelBuffers)
@@ -885,11 +809,6 @@ namespace ame
         foreach (UInt8 *v, m_ForePixelBuffers)
             delete[] v;
 
-        delete[] m_PrimaryForeground;
-        delete[] m_PrimaryBackground;
-        delete[] m_SecondaryForeground;
-        delete[] m_SecondaryBackground;
-
         m_Maps.clear();
         m_MapSizes.clear();
         m_MapPositions.clear();
@@ -904,8 +823,41 @@ namespace ame
         m_ForePixelBuffers.clear();
         m_HoveredConnection = 0;
 
+        // Drops pending edits of the previous map
+        m_EditCells.clear();
+        m_EditRect = QRect();
+        m_EditDepth = 0;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Getter
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    MapHeader *AMEMapView::editedHeader()
+    {
+        if (m_LayoutView)
+            return m_Header;
+        if (m_Maps.isEmpty() || m_Maps.at(0) == NULL)
+            return NULL;
+
+        return &m_Maps.at(0)->header();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  I/O
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    bool AMEMapView::setMap(Map *mainMap)
+    {
+        clearMaps();
+
 
-        Q_UNUSED(rom);
         const QSize mainSize = mainMap->header().size();
         const QList<Connection *> connexAll = mainMap->connections().connections();
         //filter out dive/emerge connections
@@ -1020,225 +972,35 @@ namespace ame
 
 
         // Determines the block count for each game
-        int blockCountPrimary;
-        int blockCountSecondary;
-        if (CONFIG(RomType) == RT_FRLG)
-        {
-            blockCountPrimary = 0x280;
-            blockCountSecondary = 0x180;
-        }
-        else
-        {
-            blockCountPrimary = 0x200;
-            blockCountSecondary = 0x200;
-        }
+        int blockCountPrimary = MapRenderer::primaryBlockCount();
+        int blockCountSecondary = MapRenderer::secondaryBlockCount();
 
         m_PrimaryBlockCount = blockCountPrimary;
         m_SecondaryBlockCount = blockCountSecondary;
 
 
-        // Attempts to load all the blocksets
-        QList<UInt8 *> blocksetBack;
-        QList<UInt8 *> blocksetFore;
+        // Retrieves all the blocksets; maps that share their
+        // tileset pair also share the cached blockset
+        QList<Blockset> blocksets;
         for (int i = 0; i < m_Maps.size(); i++)
         {
-            Tileset *primary = m_Maps[i]->header().primary();
-            Tileset *secondary = m_Maps[i]->header().secondary();
-            QVector<qboy::Color> palettes;
-
-            // Retrieves the palettes, combines them, removes bg color
-            for (int j = 0; j < primary->palettes().size(); j++)
-            {
-                palettes.append(primary->palettes().at(j)->raw());
-                palettes[j * 16].a = 0.0f;
-            }
-            for (int j = 0; j < secondary->palettes().size(); j++)
-            {
-                palettes.append(secondary->palettes().at(j)->raw());
-                palettes[(primary->palettes().size() * 16) + (j * 16)].a = 0.0f;
-            }
-            while (palettes.size() < 256) // align pal for OpenGL
-            {
-                palettes.push_back({ 0.f, 0.f, 0.f, 0.f });
-            }
-
+            const Blockset blockset = BlocksetCache::get(m_Maps[i]->header().primary(),
+                                                         m_Maps[i]->header().secondary());
 
             if (i == 0)
-            {
-                m_Palettes.clear();
-                for (int i = 0; i < palettes.size(); i++)
-                {
-                    qboy::Color c = palettes[i];
-                    QRgb rgb = qRgba(c.r, c.g, c.b, c.a);
-                    m_Palettes.push_back(rgb);
-                }
-            }
+                m_Palettes = blockset.palette;
             else
-            {
-                QVector<QRgb> p;
-                for (int i = 0; i < palettes.size(); i++)
-                {
-                    qboy::Color c = palettes[i];
-                    QRgb rgb = qRgba(c.r, c.g, c.b, c.a);
-                    p.push_back(rgb);
-                }
-                m_ConnPalettes.push_back(p);
-            }
-
-
-            // Retrieves the raw pixel data of the tilesets
-            const QByteArray &priRaw = primary->image()->raw();
-            const QByteArray &secRaw = secondary->image()->raw();
-            const int secRawMax = (128/8 * secondary->image()->size().height()/8);
-
-            // Creates two buffers for the blockset pixels
-            Int32 tilesetHeight1 = blockCountPrimary / 8 * 16;
-            Int32 tilesetHeight2 = blockCountSecondary / 8 * 16;
-            UInt8 *background1 = new UInt8[128 * tilesetHeight1];
-            UInt8 *foreground1 = new UInt8[128 * tilesetHeight1];
-            UInt8 *background2 = new UInt8[128 * tilesetHeight2];
-            UInt8 *foreground2 = new UInt8[128 * tilesetHeight2];
-
-            // Copy the tileset sizes for our main map
-            if (i == 0)
-            {
-                m_PrimarySetSize = QSize(128, tilesetHeight1);
-                m_SecondarySetSize = QSize(128, tilesetHeight2);
-            }
+                m_ConnPalettes.push_back(blockset.palette);
 
-
-            // Parses all the primary block data
-            for (int j = 0; j < primary->blocks().size(); j++)
-            {
-                Block *curBlock = primary->blocks()[j];
-                Int32 blockX = (j % 8) * 16;
-                Int32 blockY = (j / 8) * 16;
-
-                /* BACKGROUND */
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            background1[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-
-                /* FOREGROUND */
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k+4];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            foreground1[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-            }
-
-            // Parses all the secondary block data
-            for (int j = 0; j < secondary->blocks().size(); j++)
-            {
-                Block *curBlock = secondary->blocks()[j];
-                Int32 blockX = (j % 8) * 16;
-                Int32 blockY = (j / 8) * 16;
-
-                /* BACKGROUND */
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            background2[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-
-                /* FOREGROUND */
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k+4];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            foreground2[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-            }
-
-
-            // Adds the new blocksets
-            blocksetBack.push_back(background1);
-            blocksetBack.push_back(background2);
-            blocksetFore.push_back(foreground1);
-            blocksetFore.push_back(foreground2);
+            blocksets.push_back(blockset);
         }
 
+        // The secondary blocks follow the primary ones
+        const Int32 primarySize = 128 * (blockCountPrimary / 8 * 16);
+        m_PrimarySetSize = QSize(128, blockCountPrimary / 8 * 16);
+        m_SecondarySetSize = QSize(128, blockCountSecondary / 8 * 16);
+        m_Blockset = blocksets.at(0);
+
 
         // Creates the image for the main map
         MapHeader &header = m_Maps[0]->header();
@@ -1247,15 +1009,15 @@ namespace ame
         // Creates a new pixel buffer for the map
         UInt8 *backMapBuffer = new UInt8[mapSize.width()*16 * mapSize.height()*16];
         UInt8 *foreMapBuffer = new UInt8[mapSize.width()*16 * mapSize.height()*16];
-        UInt8 *primaryBg = blocksetBack.at(0);
-        UInt8 *secondaryBg = blocksetBack.at(1);
-        UInt8 *primaryFg = blocksetFore.at(0);
-        UInt8 *secondaryFg = blocksetFore.at(1);
+        const UInt8 *primaryBg = reinterpret_cast<const UInt8 *>(m_Blockset.background.constData());
+        const UInt8 *secondaryBg = primaryBg + primarySize;
+        const UInt8 *primaryFg = reinterpret_cast<const UInt8 *>(m_Blockset.foreground.constData());
+        const UInt8 *secondaryFg = primaryFg + primarySize;
 
         // Iterates through every map block and writes it to the map buffer
         for (int j = 0; j < header.blocks().size(); j++)
         {
-            MapBlock block = *header.blocks().at(j);
+            MapBlock block = header.blocks().at(j);
             Int32 mapX = (j % mapSize.width()) * 16;
             Int32 mapY = (j / mapSize.width()) * 16;
 
@@ -1299,10 +1061,11 @@ namespace ame
             // Creates the pixel buffers for the connected map
             UInt8 *backMapBuffer = new UInt8[absSize.width()*absSize.height()];
             UInt8 *foreMapBuffer = new UInt8[absSize.width()*absSize.height()];
-            UInt8 *primaryBg = blocksetBack.at((n+1)*2);
-            UInt8 *secondaryBg = blocksetBack.at((n+1)*2+1);
-            UInt8 *primaryFg = blocksetFore.at((n+1)*2);
-            UInt8 *secondaryFg = blocksetFore.at((n+1)*2+1);
+            const Blockset &blockset = blocksets.at(n+1);
+            const UInt8 *primaryBg = reinterpret_cast<const UInt8 *>(blockset.background.constData());
+            const UInt8 *secondaryBg = primaryBg + primarySize;
+            const UInt8 *primaryFg = reinterpret_cast<const UInt8 *>(blockset.foreground.constData());
+            const UInt8 *secondaryFg = primaryFg + primarySize;
             DirectionType dir = connexOw.at(n)->direction;
             Int32 rowCount = m_MaxRows.at(n);
 
@@ -1315,7 +1078,7 @@ namespace ame
                     int processed = (m/rowCount)*mapSize.width();
                     int blockNumber = start + processed + (m%rowCount);
 
-                    MapBlock block = *header.blocks().at(blockNumber);
+                    MapBlock block = header.blocks().at(blockNumber);
                     Int32 mapX = (m % (absSize.width()/16)) * 16;
                     Int32 mapY = (m / (absSize.width()/16)) * 16;
 
@@ -1346,7 +1109,7 @@ namespace ame
                 {
                     int blockNumber = start + m;
 
-                    MapBlock block = *header.blocks().at(blockNumber);
+                    MapBlock block = header.blocks().at(blockNumber);
                     Int32 mapX = (m % mapSize.width()) * 16;
                     Int32 mapY = (m / mapSize.width()) * 16;
 
@@ -1377,45 +1140,16 @@ namespace ame
             m_ForePixelBuffers.push_back(foreMapBuffer);
         }
 
-        // Deletes all unnecessary blocksets
-        for (int i = 0; i < blocksetBack.size(); i++)
-        {
-            if (i == 0)
-            {
-                m_PrimaryBackground = blocksetBack[0];
-                m_PrimaryForeground = blocksetFore[0];
-            }
-            else if (i == 1)
-            {
-                m_SecondaryBackground = blocksetBack[1];
-                m_SecondaryForeground = blocksetFore[1];
-            }
-            else
-            {
-                delete blocksetBack[i];
-                delete blocksetFore[i];
-            }
-
-        }
-
         const Int32 tsw = 128;
         Int32 tsh1 = blockCountPrimary / 8 * 16;
         Int32 tsh2 = blockCountSecondary / 8 * 16;
-        Int32 lpct = 128 * tsh1;
-        Int32 lsct = 128 * tsh2;
         QRgb c = m_Palettes[0];
 
+        // Both images are 128 pixels wide, thus without padding
         m_BlockForeground = QImage(tsw, tsh1 + tsh2, QImage::Format_Indexed8);
         m_BlockBackground = QImage(tsw, tsh1 + tsh2, QImage::Format_Indexed8);
-
-        for (int i = 0; i < lpct; i++)
-            m_BlockForeground.bits()[i] = m_PrimaryForeground[i];
-        for (int i = 0; i < lsct; i++)
-            m_BlockForeground.bits()[lpct+i] = m_SecondaryForeground[i];
-        for (int i = 0; i < lpct; i++)
-            m_BlockBackground.bits()[i] = m_PrimaryBackground[i];
-        for (int i = 0; i < lsct; i++)
-            m_BlockBackground.bits()[lpct+i] = m_SecondaryBackground[i];
+        memcpy(m_BlockForeground.bits(), m_Blockset.foreground.constData(), m_Blockset.foreground.size());
+        memcpy(m_BlockBackground.bits(), m_Blockset.background.constData(), m_Blockset.background.size());
 
         m_BlockForeground.setColorTable(m_Palettes);
         m_PalCopy = m_Palettes;
@@ -1465,318 +1199,102 @@ namespace ame
         m_IsInit = true;
         m_MapBackground = QPixmap::fromImage(m_iMapBackground);
         m_MapForeground = QPixmap::fromImage(m_iMapForeground);
+        resetTiles();
         setMinimumSize(m_WidgetSize);
+        update();
         return true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  I/O
-    // Contributors:   Pokedude
-    // Last edit by:   Pokedude
-    // Date of edit:   6/17/2016
+    // Contributors:   Pokedude, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
     //
     ///////////////////////////////////////////////////////////
     bool AMEMapView::setLayout(MapHeader &mainMap)
     {
+        clearMaps();
+
         const QSize mainSize = mainMap.size();
         m_Maps.push_back(NULL);
         m_MapSizes.push_back(QSize(mainSize.width()*16, mainSize.height()*16));
         m_MapPositions.push_back(QPoint(0, 0));
         m_WidgetSize = QSize(m_MapSizes.at(0));
-        m_Header = mainMap;
+        m_Header = &mainMap;
         m_LayoutView = true;
 
 
         // Determines the block count for each game
-        int blockCountPrimary;
-        int blockCountSecondary;
-        if (CONFIG(RomType) == RT_FRLG)
-        {
-            blockCountPrimary = 0x280;
-            blockCountSecondary = 0x180;
-        }
-        else
-        {
-            blockCountPrimary = 0x200;
-            blockCountSecondary = 0x200;
-        }
+        int blockCountPrimary = MapRenderer::primaryBlockCount();
+        int blockCountSecondary = MapRenderer::secondaryBlockCount();
 
         m_PrimaryBlockCount = blockCountPrimary;
         m_SecondaryBlockCount = blockCountSecondary;
 
 
-        // Attempts to load all the blocksets
-        QList<UInt8 *> blocksetBack;
-        QList<UInt8 *> blocksetFore;
-        for (int i = 0; i < 1; i++)
-        {
-            Tileset *primary = mainMap.primary();
-            Tileset *secondary = mainMap.secondary();
-            QVector<qboy::Color> palettes;
-
-            // Retrieves the palettes, combines them, removes bg color
-            for (int j = 0; j < primary->palettes().size(); j++)
-            {
-                palettes.append(primary->palettes().at(j)->raw());
-                palettes[j * 16].a = 0.0f;
-            }
-            for (int j = 0; j < secondary->palettes().size(); j++)
-            {
-                palettes.append(secondary->palettes().at(j)->raw());
-                palettes[(primary->palettes().size() * 16) + (j * 16)].a = 0.0f;
-            }
-
-            while (palettes.size() < 256) // align pal for OpenGL
-            {
-                palettes.push_back({ 0.f, 0.f, 0.f, 0.f });
-            }
-
+        // Retrieves the blockset; the secondary blocks follow the primary ones
+        m_Blockset = BlocksetCache::get(mainMap.primary(), mainMap.secondary());
+        m_Palettes = m_Blockset.palette;
 
-            m_Palettes.clear();
-            for (int i = 0; i < palettes.size(); i++)
-            {
-                qboy::Color c = palettes[i];
-                QRgb rgb = qRgba(c.r, c.g, c.b, c.a);
-                m_Palettes.push_back(rgb);
-            }
+        const Int32 primarySize = 128 * (blockCountPrimary / 8 * 16);
+        m_PrimarySetSize = QSize(128, blockCountPrimary / 8 * 16);
+        m_SecondarySetSize = QSize(128, blockCountSecondary / 8 * 16);
 
 
-            // Retrieves the raw pixel data of the tilesets
-            const QByteArray &priRaw = primary->image()->raw();
-            const QByteArray &secRaw = secondary->image()->raw();
-            const int secRawMax = (128/8 * secondary->image()->size().height()/8);
-
-            // Creates two buffers for the blockset pixels
-            Int32 tilesetHeight1 = blockCountPrimary / 8 * 16;
-            Int32 tilesetHeight2 = blockCountSecondary / 8 * 16;
-            UInt8 *background1 = new UInt8[128 * tilesetHeight1];
-            UInt8 *foreground1 = new UInt8[128 * tilesetHeight1];
-            UInt8 *background2 = new UInt8[128 * tilesetHeight2];
-            UInt8 *foreground2 = new UInt8[128 * tilesetHeight2];
-
-            // Copy the tileset sizes for our main map
-            if (i == 0)
-            {
-                m_PrimarySetSize = QSize(128, tilesetHeight1);
-                m_SecondarySetSize = QSize(128, tilesetHeight2);
-            }
-
-            // Parses all the primary block data
-            for (int j = 0; j < primary->blocks().size(); j++)
-            {
-                Block *curBlock = primary->blocks()[j];
-                Int32 blockX = (j % 8) * 16;
-                Int32 blockY = (j / 8) * 16;
-
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            background1[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k+4];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            foreground1[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-            }
-
-            // Parses all the secondary block data
-            for (int j = 0; j < secondary->blocks().size(); j++)
-            {
-                Block *curBlock = secondary->blocks()[j];
-                Int32 blockX = (j % 8) * 16;
-                Int32 blockY = (j / 8) * 16;
-
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            background2[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-
-                for (int k = 0; k < 4; k++)
-                {
-                    Tile tile = curBlock->tiles[k+4];
-                    Int32 subX = ((k % 2) * 8) + blockX;
-                    Int32 subY = ((k / 2) * 8) + blockY;;
-
-                    if (tile.tile >= blockCountPrimary)
-                    {
-                        tile.tile -= blockCountPrimary;
-
-                        if (secRawMax > tile.tile)
-                            extractTile(secRaw, tile);
-                        else
-                            memset(pixelBuffer, 0, 64);
-                    }
-                    else
-                    {
-                        extractTile(priRaw, tile);
-                    }
-
-                    int pos = 0;
-                    for (int y = 0; y < 8; y++)
-                        for (int x = 0; x < 8; x++)
-                            foreground2[(x+subX) + (y+subY) * 128] = pixelBuffer[pos++];
-                }
-            }
+        // Creates the image for the layout
+        const QSize mapSize = mainMap.size();
+        const QSize absSize = m_MapSizes.at(0);
+        UInt8 *backMapBuffer = new UInt8[absSize.width() * absSize.height()];
+        UInt8 *foreMapBuffer = new UInt8[absSize.width() * absSize.height()];
+        const UInt8 *primaryBg = reinterpret_cast<const UInt8 *>(m_Blockset.background.constData());
+        const UInt8 *secondaryBg = primaryBg + primarySize;
+        const UInt8 *primaryFg = reinterpret_cast<const UInt8 *>(m_Blockset.foreground.constData());
+        const UInt8 *secondaryFg = primaryFg + primarySize;
 
-
-            // Adds the new blocksets
-            blocksetBack.push_back(background1);
-            blocksetBack.push_back(background2);
-            blocksetFore.push_back(foreground1);
-            blocksetFore.push_back(foreground2);
-        }
-
-
-        // Creates the images for the actual maps
-        for (int i = 0; i < m_Maps.size(); i++)
+        // Iterates through every map block and writes it to the map buffer
+        for (int j = 0; j < mainMap.blocks().size(); j++)
         {
-            MapHeader &header = m_Maps[i]->header();
-            QSize mapSize = m_MapSizes[i];
-
-            // Creates a new pixel buffer for the map
-            UInt8 *backMapBuffer = new UInt8[mapSize.width() * mapSize.height()];
-            UInt8 *foreMapBuffer = new UInt8[mapSize.width() * mapSize.height()];
-            UInt8 *primaryBg = blocksetBack.at(i*2);
-            UInt8 *secondaryBg = blocksetBack.at(i*2+1);
-            UInt8 *primaryFg = blocksetFore.at(i*2);
-            UInt8 *secondaryFg = blocksetFore.at(i*2+1);
-
-            // Iterates through every map block and writes it to the map buffer
-            for (int j = 0; j < header.blocks().size(); j++)
-            {
-                MapBlock block = *header.blocks().at(j);
-                Int32 mapX = (j % mapSize.width()) * 16;
-                Int32 mapY = (j / mapSize.width()) * 16;
-
-                if (block.block >= blockCountPrimary)
-                    extractBlock(secondaryBg, block.block - blockCountPrimary);
-                else
-                    extractBlock(primaryBg, block.block);
-
-                int pos = 0;
-                for (int y = 0; y < 16; y++)
-                    for (int x = 0; x < 16; x++)
-                        backMapBuffer[(x+mapX) + (y+mapY) * mapSize.width()*16] = blockBuffer[pos++];
-
-                if (block.block >= blockCountPrimary)
-                    extractBlock(secondaryFg, block.block - blockCountPrimary);
-                else
-                    extractBlock(primaryFg, block.block);
+            MapBlock block = mainMap.blocks().at(j);
+            Int32 mapX = (j % mapSize.width()) * 16;
+            Int32 mapY = (j / mapSize.width()) * 16;
 
-                pos = 0;
-                for (int y = 0; y < 16; y++)
-                    for (int x = 0; x < 16; x++)
-                        foreMapBuffer[(x+mapX) + (y+mapY) * mapSize.width()*16] = blockBuffer[pos++];
-            }
+            if (block.block >= blockCountPrimary)
+                extractBlock(secondaryBg, block.block - blockCountPrimary);
+            else
+                extractBlock(primaryBg, block.block);
 
-            // Appends the pixel buffers
-            m_BackPixelBuffers.push_back(backMapBuffer);
-            m_ForePixelBuffers.push_back(foreMapBuffer);
-        }
+            int pos = 0;
+            for (int y = 0; y < 16; y++)
+                for (int x = 0; x < 16; x++)
+                    backMapBuffer[(x+mapX) + (y+mapY) * absSize.width()] = blockBuffer[pos++];
 
-        // Deletes all unnecessary blocksets
-        for (int i = 0; i < blocksetBack.size(); i++)
-        {
-            if (i == 0)
-            {
-                m_PrimaryBackground = blocksetBack[0];
-                m_PrimaryForeground = blocksetFore[0];
-            }
-            else if (i == 1)
-            {
-                m_SecondaryBackground = blocksetBack[1];
-                m_SecondaryForeground = blocksetFore[1];
-            }
+            if (block.block >= blockCountPrimary)
+                extractBlock(secondaryFg, block.block - blockCountPrimary);
             else
-            {
-                delete blocksetBack[i];
-                delete blocksetFore[i];
-            }
+                extractBlock(primaryFg, block.block);
 
+            pos = 0;
+            for (int y = 0; y < 16; y++)
+                for (int x = 0; x < 16; x++)
+                    foreMapBuffer[(x+mapX) + (y+mapY) * absSize.width()] = blockBuffer[pos++];
         }
 
+        // Appends the pixel buffers
+        m_BackPixelBuffers.push_back(backMapBuffer);
+        m_ForePixelBuffers.push_back(foreMapBuffer);
+
 
         const Int32 tsw = 128;
         Int32 tsh1 = blockCountPrimary / 8 * 16;
         Int32 tsh2 = blockCountSecondary / 8 * 16;
-        Int32 lpct = 128 * tsh1;
-        Int32 lsct = 128 * tsh2;
         QRgb c = m_Palettes[0];
 
+        // Both images are 128 pixels wide, thus without padding
         m_BlockForeground = QImage(tsw, tsh1 + tsh2, QImage::Format_Indexed8);
         m_BlockBackground = QImage(tsw, tsh1 + tsh2, QImage::Format_Indexed8);
-
-        for (int i = 0; i < lpct; i++)
-            m_BlockForeground.bits()[i] = m_PrimaryForeground[i];
-        for (int i = 0; i < lsct; i++)
-            m_BlockForeground.bits()[lpct+i] = m_SecondaryForeground[i];
-        for (int i = 0; i < lpct; i++)
-            m_BlockBackground.bits()[i] = m_PrimaryBackground[i];
-        for (int i = 0; i < lsct; i++)
-            m_BlockBackground.bits()[lpct+i] = m_SecondaryBackground[i];
+        memcpy(m_BlockForeground.bits(), m_Blockset.foreground.constData(), m_Blockset.foreground.size());
+        memcpy(m_BlockBackground.bits(), m_Blockset.background.constData(), m_Blockset.background.size());
 
         m_BlockForeground.setColorTable(m_Palettes);
         m_PalCopy = m_Palettes;
@@ -1797,23 +1315,28 @@ namespace ame
         m_iMapBackground.setColorTable(m_PalCopy);
         m_MapForeground = QPixmap::fromImage(m_iMapForeground);
         m_MapBackground = QPixmap::fromImage(m_iMapBackground);
+        resetTiles();
 
         m_IsInit = true;
         setMinimumSize(m_WidgetSize);
+        update();
         return true;
     }
 
     ///////////////////////////////////////////////////////////
     // Function type:  Event
-    // Contributors:   Pokedude, Diegoisawesome
-    // Last edit by:   Diegoisawesome
-    // Date of edit:   11/7/2016
+    // Contributors:   Pokedude, Diegoisawesome, agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Only the tiles, permissions and grid lines within the
+    // exposed rectangle are drawn, so the cost of a repaint
+    // depends on the visible area rather than the map size.
     //
     ///////////////////////////////////////////////////////////
     void AMEMapView::paintEvent(QPaintEvent *event)
     {
-        Q_UNUSED(event);
-
         if (m_IsInit)
         {
 			/*QPoint mapCoords = mapFromGlobal(QCursor::pos());	// this is meant to catch scrolls and other jumps
@@ -1825,48 +1348,58 @@ namespace ame
 			QRect result = m_Cursor.mouseMoveEvent(mapCoords);*/
 
 
-            QPoint pmain = mainPos();
+            const QRect exposed = event->rect() & QRect(QPoint(0, 0), m_WidgetSize);
             QPainter painter(this);
-            painter.drawPixmap(pmain.x(), pmain.y(), m_MapBackground);
-
-            // Between background and foreground, draw the overworld sprites on the map.
-            painter.drawPixmap(pmain.x(), pmain.y(), m_MapForeground);
 
-            if (!m_LayoutView)
+            // Draws the composed tiles; between background and foreground,
+            // the overworld sprites will be drawn on the map
+            if (!exposed.isEmpty())
             {
-                int conncnt = m_MapSizes.size()-1;
-                for (int i = 0; i < conncnt; i++)
+                const Int32 firstColumn = exposed.left() / MV_TILE_SIZE;
+                const Int32 lastColumn = exposed.right() / MV_TILE_SIZE;
+                const Int32 firstRow = exposed.top() / MV_TILE_SIZE;
+                const Int32 lastRow = exposed.bottom() / MV_TILE_SIZE;
+
+                for (int row = firstRow; row <= lastRow; row++)
                 {
-                    QPoint pconn = m_MapPositions.at(i+1);
-                    painter.drawImage(pconn.x(), pconn.y(), m_ConnImages.at(i));
+                    for (int column = firstColumn; column <= lastColumn; column++)
+                    {
+                        const Int32 index = column + row * m_TileColumns;
+                        if (m_DirtyTiles.testBit(index))
+                            composeTile(index);
+
+                        painter.drawPixmap(column * MV_TILE_SIZE, row * MV_TILE_SIZE, m_Tiles.at(index));
+                    }
                 }
             }
 
-            // Draws the movement data, if requested
+            // Determines the exposed blocks of the main map
             QPoint orig = m_MapPositions.at(0);
-            if (m_MovementMode)
+            const MapHeader &header = (m_LayoutView) ? *m_Header : m_Maps.at(0)->header();
+            const QSize &ms = header.size();
+            const QRect visible = QRect(exposed.topLeft() - orig, exposed.size()) & QRect(QPoint(0, 0), m_MapSizes.at(0));
+            const Int32 left = visible.left() / 16;
+            const Int32 top = visible.top() / 16;
+            const Int32 right = visible.right() / 16;
+            const Int32 bottom = visible.bottom() / 16;
+
+            // Draws the movement data, if requested
+            if (m_MovementMode && !visible.isEmpty())
             {
-                painter.setOpacity(SETTINGS(Translucency) / 100.0f);
+                if (m_PermLayer.isNull())
+                    renderPermissions(QRect(QPoint(0, 0), ms));
 
-                const QSize &ms = m_Maps.at(0)->header().size();
-                const QList<MapBlock *> &blocks = m_Maps.at(0)->header().blocks();
-                for (int i = 0; i < blocks.size(); i++)
-                {
-                    int mapX = (i % ms.width()) * 16 + orig.x();
-                    int mapY = (i / ms.width()) * 16 + orig.y();
-                    int posY = blocks.at(i)->permission * 16;
-                    painter.drawImage(QRect(mapX, mapY, 16, 16), m_MovePerm, QRect(0, posY, 16, 16));
-                }
+                painter.setOpacity(SETTINGS(Translucency) / 100.0f);
+                painter.drawPixmap(visible.topLeft() + orig, m_PermLayer, visible);
                 painter.setOpacity(1.0f);
             }
-            if (m_ShowGrid)
+            if (m_ShowGrid && !visible.isEmpty())
             {
-                const QSize &ms = m_Maps.at(0)->header().size();
                 QVector<QLine> lines;
-                for (int i = 0; i < ms.width(); i++)
-                    lines.append(QLine(orig.x() + (i * 16), orig.y(), orig.x() + (i * 16), orig.y() + ms.height() * 16 - 1));
-                for (int i = 0; i < ms.height(); i++)
-                    lines.append(QLine(orig.x(), orig.y() + (i * 16), orig.x() + ms.width() * 16 - 1, orig.y() + (i * 16)));
+                for (int i = left; i <= right; i++)
+                    lines.append(QLine(orig.x() + (i * 16), orig.y() + (top * 16), orig.x() + (i * 16), orig.y() + (bottom * 16) + 15));
+                for (int i = top; i <= bottom; i++)
+                    lines.append(QLine(orig.x() + (left * 16), orig.y() + (i * 16), orig.x() + (right * 16) + 15, orig.y() + (i * 16)));
                 painter.setPen(Qt::GlobalColor::black);
                 painter.drawLines(lines);
             }
@@ -1981,6 +1514,142 @@ namespace ame
         }
     }
 
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::resetTiles()
+    {
+        m_TileColumns = (m_WidgetSize.width() + MV_TILE_SIZE - 1) / MV_TILE_SIZE;
+        const Int32 rows = (m_WidgetSize.height() + MV_TILE_SIZE - 1) / MV_TILE_SIZE;
+
+        m_Tiles.clear();
+        m_Tiles.resize(m_TileColumns * rows);
+        m_DirtyTiles.fill(true, m_TileColumns * rows);
+        m_PermLayer = QPixmap();
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // Draws the parts of the main map and the connections that
+    // fall into the tile, in the same order as they overlap.
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::composeTile(Int32 index)
+    {
+        const QRect area = QRect((index % m_TileColumns) * MV_TILE_SIZE, (index / m_TileColumns) * MV_TILE_SIZE,
+                                 MV_TILE_SIZE, MV_TILE_SIZE) & QRect(QPoint(0, 0), m_WidgetSize);
+
+        QPixmap tile(area.size());
+        tile.fill(Qt::transparent);
+
+        QPainter painter(&tile);
+        painter.translate(-area.topLeft());
+
+        const QRect mainRect(m_MapPositions.at(0), m_MapSizes.at(0));
+        const QRect mainPart = mainRect & area;
+        if (!mainPart.isEmpty())
+        {
+            const QRect source = mainPart.translated(-mainRect.topLeft());
+            painter.drawPixmap(mainPart.topLeft(), m_MapBackground, source);
+            painter.drawPixmap(mainPart.topLeft(), m_MapForeground, source);
+        }
+
+        if (!m_LayoutView)
+        {
+            for (int i = 0; i < m_ConnImages.size(); i++)
+            {
+                const QRect connRect(m_MapPositions.at(i+1), m_MapSizes.at(i+1));
+                const QRect connPart = connRect & area;
+                if (!connPart.isEmpty())
+                    painter.drawImage(connPart.topLeft(), m_ConnImages.at(i), connPart.translated(-connRect.topLeft()));
+            }
+        }
+
+        painter.end();
+        m_Tiles[index] = tile;
+        m_DirtyTiles.clearBit(index);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    QRect AMEMapView::blockRect(const QRect &blocks) const
+    {
+        return QRect(m_MapPositions.at(0) + blocks.topLeft() * 16, blocks.size() * 16);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::invalidateBlocks(const QRect &blocks)
+    {
+        const QRect area = blockRect(blocks) & QRect(QPoint(0, 0), m_WidgetSize);
+        if (area.isEmpty())
+            return;
+
+        for (int row = area.top() / MV_TILE_SIZE; row <= area.bottom() / MV_TILE_SIZE; row++)
+            for (int column = area.left() / MV_TILE_SIZE; column <= area.right() / MV_TILE_SIZE; column++)
+                m_DirtyTiles.setBit(column + row * m_TileColumns);
+
+        update(area);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Function type:  Helper
+    // Contributors:   agent
+    // Last edit by:   agent
+    // Date of edit:   10/17/2026
+    // Comment:
+    //
+    // The layer is opaque; the translucency is applied once
+    // when it is drawn to the widget.
+    //
+    ///////////////////////////////////////////////////////////
+    void AMEMapView::renderPermissions(const QRect &blocks)
+    {
+        const MapHeader &header = (m_LayoutView) ? *m_Header : m_Maps.at(0)->header();
+        const QSize ms = header.size();
+        const QRect area = blocks & QRect(QPoint(0, 0), ms);
+
+        if (m_PermLayer.isNull())
+        {
+            m_PermLayer = QPixmap(m_MapSizes.at(0));
+            m_PermLayer.fill(Qt::transparent);
+        }
+
+        QPainter painter(&m_PermLayer);
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+
+        const UInt16 *cells = header.blocks().data();
+        for (int y = area.top(); y <= area.bottom(); y++)
+        {
+            for (int x = area.left(); x <= area.right(); x++)
+            {
+                int posY = (cells[x + y * ms.width()] >> MBG_PERM_SHIFT) * 16;
+                painter.drawImage(QRect(x * 16, y * 16, 16, 16), m_MovePerm, QRect(0, posY, 16, 16));
+            }
+        }
+
+        painter.end();
+    }
+
     ///////////////////////////////////////////////////////////
     // Function type:  Setter
     // Contributors:   Pokedude
@@ -2050,7 +1719,7 @@ namespace ame
     ///////////////////////////////////////////////////////////
     MapHeader *AMEMapView::layoutHeader()
     {
-        return &m_Header;
+        return m_Header;
     }
 
     ///////////////////////////////////////////////////////////
@@ -2146,7 +1815,7 @@ namespace ame
     ///////////////////////////////////////////////////////////
     MapBorder &AMEMapView::border()
     {
-        return m_Header.border();
+        return m_Header->border();
     }
 
     ///////////////////////////////////////////////////////////